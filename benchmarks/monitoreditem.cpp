@@ -0,0 +1,96 @@
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "open62541pp/client.hpp"
+#include "open62541pp/config.hpp"
+#include "open62541pp/detail/client_context.hpp"
+#include "open62541pp/services/monitoreditem.hpp"
+#include "open62541pp/ua/types.hpp"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+using namespace opcua;
+
+static CreateMonitoredItemsResponse makeResponse(size_t size) {
+    CreateMonitoredItemsResponse response;
+    auto* results = static_cast<UA_MonitoredItemCreateResult*>(
+        UA_Array_new(size, &UA_TYPES[UA_TYPES_MONITOREDITEMCREATERESULT])
+    );
+    for (size_t i = 0; i < size; ++i) {
+        results[i].monitoredItemId = static_cast<IntegerId>(i + 1);  // NOLINT
+    }
+    response->results = results;
+    response->resultsSize = size;
+    return response;
+}
+
+static CreateMonitoredItemsRequest makeRequest(size_t size) {
+    CreateMonitoredItemsRequest request;
+    auto* items = static_cast<UA_MonitoredItemCreateRequest*>(
+        UA_Array_new(size, &UA_TYPES[UA_TYPES_MONITOREDITEMCREATEREQUEST])
+    );
+    for (size_t i = 0; i < size; ++i) {
+        items[i].itemToMonitor.nodeId = UA_NODEID_NUMERIC(1, static_cast<uint32_t>(i));  // NOLINT
+        items[i].itemToMonitor.attributeId = UA_ATTRIBUTEID_VALUE;  // NOLINT
+    }
+    request->itemsToCreate = items;
+    request->itemsToCreateSize = size;
+    return request;
+}
+
+// create contexts of monitored items with shared callbacks before a bulk creation
+static void makeMonitoredItemContexts(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    const auto request = makeRequest(size);
+    Client client;
+    // capture enough state to exceed the small buffer of std::function
+    const auto callback = [&client, &state, size](IntegerId, IntegerId, const DataValue&) {
+        benchmark::DoNotOptimize(&client);
+        benchmark::DoNotOptimize(&state);
+        benchmark::DoNotOptimize(size);
+    };
+
+    for (auto _ : state) {
+        auto contexts = services::detail::makeMonitoredItemContexts(
+            client, request, callback, {}, {}
+        );
+        benchmark::DoNotOptimize(contexts);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(makeMonitoredItemContexts)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000)
+    ->Unit(benchmark::kMillisecond);
+
+// store contexts of monitored items after a (simulated) bulk creation
+static void storeMonitoredItemContexts(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    const auto response = makeResponse(size);
+    std::optional<Client> client;
+    std::vector<std::unique_ptr<services::detail::MonitoredItemContext>> contexts(size);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        client.emplace();  // empty context map
+        for (auto& context : contexts) {
+            context = std::make_unique<services::detail::MonitoredItemContext>();
+        }
+        state.ResumeTiming();
+
+        services::detail::storeMonitoredItemContexts(*client, 1U, response, contexts);
+        benchmark::DoNotOptimize(detail::getContext(*client).monitoredItems);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(storeMonitoredItemContexts)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000)
+    ->Unit(benchmark::kMillisecond);
+
+#endif
@@ -0,0 +1,331 @@
+#include <algorithm>  // sort
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <utility>  // move
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "open62541pp/client.hpp"
+#include "open62541pp/config.hpp"
+#include "open62541pp/server.hpp"
+#include "open62541pp/services/attribute.hpp"
+#include "open62541pp/services/method.hpp"
+#include "open62541pp/services/nodemanagement.hpp"
+#include "open62541pp/services/view.hpp"
+#include "open62541pp/ua/nodeids.hpp"
+#include "open62541pp/ua/types.hpp"
+
+#include "helper/server_runner.hpp"
+
+using namespace opcua;
+
+/* ------------------------------------------- Setup -------------------------------------------- */
+
+enum class Payload {
+    Double,  // scalar double
+    ByteString,  // 1 MB ByteString
+    ExtensionObjectArray,  // array of 1024 ExtensionObjects (decoded Argument)
+};
+
+enum class Completion {
+    Sync,
+    Async,
+};
+
+static Variant makePayload(Payload payload) {
+    switch (payload) {
+    case Payload::Double:
+        return Variant{11.11};
+    case Payload::ByteString:
+        return Variant{ByteString{std::vector<uint8_t>(1024 * 1024, 0xFF)}};
+    case Payload::ExtensionObjectArray: {
+        const Argument argument{
+            "Temperature",
+            {"en-US", "Temperature of the sensor in degree Celsius"},
+            DataTypeId::Double,
+            ValueRank::Scalar
+        };
+        return Variant{std::vector<ExtensionObject>(1024, ExtensionObject{argument})};
+    }
+    }
+    return {};
+}
+
+static NodeId payloadNodeId(Payload payload) {
+    return {1, 1000 + static_cast<uint32_t>(payload)};
+}
+
+static const NodeId methodId{1, 2000};
+
+/// In-process server with a connected client, shared by all service benchmarks.
+struct Loopback {
+    Server server;
+    ServerRunner serverRunner{server};
+    Client client;
+
+    Loopback() {
+        for (auto payload :
+             {Payload::Double, Payload::ByteString, Payload::ExtensionObjectArray}) {
+            services::addVariable(
+                server,
+                ObjectId::ObjectsFolder,
+                payloadNodeId(payload),
+                "Variable",
+                VariableAttributes{}
+                    .setAccessLevel(AccessLevel::CurrentRead | AccessLevel::CurrentWrite)
+                    .setValue(makePayload(payload)),
+                VariableTypeId::BaseDataVariableType,
+                ReferenceTypeId::HasComponent
+            )
+                .value();
+        }
+#ifdef UA_ENABLE_METHODCALLS
+        services::addMethod(
+            server,
+            ObjectId::ObjectsFolder,
+            methodId,
+            "Add",
+            [](Span<const Variant> inputs, Span<Variant> outputs) {
+                outputs[0] = inputs[0].scalar<double>() + inputs[1].scalar<double>();
+            },
+            {
+                Argument{"a", {}, DataTypeId::Double, ValueRank::Scalar},
+                Argument{"b", {}, DataTypeId::Double, ValueRank::Scalar},
+            },
+            {
+                Argument{"sum", {}, DataTypeId::Double, ValueRank::Scalar},
+            },
+            MethodAttributes{},
+            ReferenceTypeId::HasComponent
+        )
+            .value();
+#endif
+        client.config().setLogger([](auto&&...) {});
+        client.connect("opc.tcp://localhost:4840");
+    }
+};
+
+static Loopback& loopback() {
+    static Loopback instance;
+    return instance;
+}
+
+/// Send an async request with a callback token and iterate the client until it completed.
+template <typename Response, typename Initiate>
+static Response runAsync(Client& client, Initiate&& initiate) {
+    std::optional<Response> response;
+    initiate([&](Response& result) { response = std::move(result); });
+    while (!response.has_value()) {
+        client.runIterate(0);
+    }
+    return std::move(*response);
+}
+
+/// Record the latency of each iteration and report p50/p99 (in µs) and the item throughput.
+class LatencyRecorder {
+public:
+    explicit LatencyRecorder(benchmark::State& state, size_t itemsPerIteration = 1)
+        : state_{state},
+          itemsPerIteration_{itemsPerIteration} {}
+
+    LatencyRecorder(const LatencyRecorder&) = delete;
+    LatencyRecorder(LatencyRecorder&&) = delete;
+    LatencyRecorder& operator=(const LatencyRecorder&) = delete;
+    LatencyRecorder& operator=(LatencyRecorder&&) = delete;
+
+    ~LatencyRecorder() {
+        if (latencies_.empty()) {
+            return;
+        }
+        std::sort(latencies_.begin(), latencies_.end());
+        state_.counters["p50_us"] = percentile(0.50);
+        state_.counters["p99_us"] = percentile(0.99);
+        state_.SetItemsProcessed(
+            state_.iterations() * static_cast<int64_t>(itemsPerIteration_)
+        );
+    }
+
+    template <typename F>
+    void measure(F&& func) {
+        const auto start = Clock::now();
+        std::forward<F>(func)();
+        latencies_.push_back(Clock::now() - start);
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    double percentile(double p) const {
+        const auto index = static_cast<size_t>(p * static_cast<double>(latencies_.size() - 1));
+        return std::chrono::duration<double, std::micro>(latencies_[index]).count();
+    }
+
+    benchmark::State& state_;
+    size_t itemsPerIteration_;
+    std::vector<Clock::duration> latencies_;
+};
+
+static void checkGood(benchmark::State& state, StatusCode code) {
+    if (code.isBad()) {
+        state.SkipWithError(code.name().data());
+    }
+}
+
+/* ------------------------------------------- Sweeps ------------------------------------------- */
+
+// batch size × payload; large payloads are capped by the default max message size (64 MB)
+static void batchSweep(benchmark::internal::Benchmark* bench) {
+    bench->ArgNames({"batch", "payload"});
+    for (int64_t batch : {1, 10, 100, 1000, 10000}) {
+        bench->Args({batch, static_cast<int64_t>(Payload::Double)});
+    }
+    for (int64_t batch : {1, 4, 16}) {
+        bench->Args({batch, static_cast<int64_t>(Payload::ByteString)});
+    }
+    for (int64_t batch : {1, 8, 64}) {
+        bench->Args({batch, static_cast<int64_t>(Payload::ExtensionObjectArray)});
+    }
+    bench->UseRealTime();
+}
+
+static void batchOnlySweep(benchmark::internal::Benchmark* bench) {
+    bench->ArgName("batch");
+    for (int64_t batch : {1, 10, 100, 1000, 10000}) {
+        bench->Arg(batch);
+    }
+    bench->UseRealTime();
+}
+
+/* -------------------------------------------- Read -------------------------------------------- */
+
+static void read(benchmark::State& state, Completion completion) {
+    auto& client = loopback().client;
+    const auto batch = static_cast<size_t>(state.range(0));
+    const auto payload = static_cast<Payload>(state.range(1));
+    const std::vector<ReadValueId> nodesToRead(
+        batch, ReadValueId{payloadNodeId(payload), AttributeId::Value}
+    );
+    const ReadRequest request{{}, 0, TimestampsToReturn::Neither, nodesToRead};
+
+    LatencyRecorder recorder{state, batch};
+    for (auto _ : state) {
+        recorder.measure([&] {
+            auto response = completion == Completion::Sync
+                ? services::read(client, request)
+                : runAsync<ReadResponse>(client, [&](auto&& token) {
+                      services::readAsync(client, request, std::move(token));
+                  });
+            checkGood(state, response.responseHeader().serviceResult());
+            benchmark::DoNotOptimize(response);
+        });
+    }
+}
+
+BENCHMARK_CAPTURE(read, Sync, Completion::Sync)->Apply(batchSweep);
+BENCHMARK_CAPTURE(read, Async, Completion::Async)->Apply(batchSweep);
+
+/* -------------------------------------------- Write ------------------------------------------- */
+
+static void write(benchmark::State& state, Completion completion) {
+    auto& client = loopback().client;
+    const auto batch = static_cast<size_t>(state.range(0));
+    const auto payload = static_cast<Payload>(state.range(1));
+    const std::vector<WriteValue> nodesToWrite(
+        batch,
+        WriteValue{
+            payloadNodeId(payload), AttributeId::Value, {}, DataValue{makePayload(payload)}
+        }
+    );
+    const WriteRequest request{{}, nodesToWrite};
+
+    LatencyRecorder recorder{state, batch};
+    for (auto _ : state) {
+        recorder.measure([&] {
+            auto response = completion == Completion::Sync
+                ? services::write(client, request)
+                : runAsync<WriteResponse>(client, [&](auto&& token) {
+                      services::writeAsync(client, request, std::move(token));
+                  });
+            checkGood(state, response.responseHeader().serviceResult());
+            benchmark::DoNotOptimize(response);
+        });
+    }
+}
+
+BENCHMARK_CAPTURE(write, Sync, Completion::Sync)->Apply(batchSweep);
+BENCHMARK_CAPTURE(write, Async, Completion::Async)->Apply(batchSweep);
+
+/* ------------------------------------------- Browse ------------------------------------------- */
+
+static void browse(benchmark::State& state, Completion completion) {
+    auto& client = loopback().client;
+    const auto batch = static_cast<size_t>(state.range(0));
+    const std::vector<BrowseDescription> nodesToBrowse(
+        batch, BrowseDescription{ObjectId::Server, BrowseDirection::Both}
+    );
+    const BrowseRequest request{{}, {}, 0, nodesToBrowse};
+
+    LatencyRecorder recorder{state, batch};
+    for (auto _ : state) {
+        recorder.measure([&] {
+            auto response = completion == Completion::Sync
+                ? services::browse(client, request)
+                : runAsync<BrowseResponse>(client, [&](auto&& token) {
+                      services::browseAsync(client, request, std::move(token));
+                  });
+            checkGood(state, response.responseHeader().serviceResult());
+            benchmark::DoNotOptimize(response);
+        });
+    }
+}
+
+BENCHMARK_CAPTURE(browse, Sync, Completion::Sync)->Apply(batchOnlySweep);
+BENCHMARK_CAPTURE(browse, Async, Completion::Async)->Apply(batchOnlySweep);
+
+static void browseAll(benchmark::State& state) {
+    auto& client = loopback().client;
+    const BrowseDescription bd{ObjectId::Server, BrowseDirection::Both};
+
+    LatencyRecorder recorder{state};
+    for (auto _ : state) {
+        recorder.measure([&] {
+            auto result = services::browseAll(client, bd);
+            checkGood(state, result.code());
+            benchmark::DoNotOptimize(result);
+        });
+    }
+}
+
+BENCHMARK(browseAll)->UseRealTime();
+
+/* -------------------------------------------- Call -------------------------------------------- */
+
+#ifdef UA_ENABLE_METHODCALLS
+static void call(benchmark::State& state, Completion completion) {
+    auto& client = loopback().client;
+    const auto batch = static_cast<size_t>(state.range(0));
+    const std::vector<Variant> inputArguments{Variant{1.0}, Variant{2.0}};
+    const std::vector<CallMethodRequest> methodsToCall(
+        batch, CallMethodRequest{ObjectId::ObjectsFolder, methodId, inputArguments}
+    );
+    const CallRequest request{{}, methodsToCall};
+
+    LatencyRecorder recorder{state, batch};
+    for (auto _ : state) {
+        recorder.measure([&] {
+            auto response = completion == Completion::Sync
+                ? services::call(client, request)
+                : runAsync<CallResponse>(client, [&](auto&& token) {
+                      services::callAsync(client, request, std::move(token));
+                  });
+            checkGood(state, response.responseHeader().serviceResult());
+            benchmark::DoNotOptimize(response);
+        });
+    }
+}
+
+BENCHMARK_CAPTURE(call, Sync, Completion::Sync)->Apply(batchOnlySweep);
+BENCHMARK_CAPTURE(call, Async, Completion::Async)->Apply(batchOnlySweep);
+#endif
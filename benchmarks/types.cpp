@@ -0,0 +1,172 @@
+#include <functional>  // hash
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>  // move
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "open62541pp/types.hpp"
+
+using namespace opcua;
+
+/* ---------------------------------------- String-like ----------------------------------------- */
+
+template <typename T>
+static void stringConstruct(benchmark::State& state) {
+    const std::string str(static_cast<size_t>(state.range(0)), 'x');
+    for (auto _ : state) {
+        T wrapper{std::string_view{str}};
+        benchmark::DoNotOptimize(wrapper);
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(stringConstruct, String)->RangeMultiplier(8)->Range(8, 8 << 10);
+BENCHMARK_TEMPLATE(stringConstruct, ByteString)->RangeMultiplier(8)->Range(8, 8 << 10);
+
+template <typename T>
+static void stringCopy(benchmark::State& state) {
+    const std::string str(static_cast<size_t>(state.range(0)), 'x');
+    const T src{std::string_view{str}};
+    for (auto _ : state) {
+        T dst{src};
+        benchmark::DoNotOptimize(dst);
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(stringCopy, String)->RangeMultiplier(8)->Range(8, 8 << 10);
+BENCHMARK_TEMPLATE(stringCopy, ByteString)->RangeMultiplier(8)->Range(8, 8 << 10);
+
+/* ------------------------------------------- NodeId ------------------------------------------- */
+
+static NodeId makeNodeId(bool stringIdentifier) {
+    return stringIdentifier ? NodeId{1, "Objects.Device.Sensors.Temperature"} : NodeId{1, 1000};
+}
+
+static void nodeIdHash(benchmark::State& state) {
+    const auto id = makeNodeId(state.range(0) != 0);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::hash<NodeId>{}(id));
+    }
+}
+
+BENCHMARK(nodeIdHash)->ArgName("string")->Arg(0)->Arg(1);
+
+static void nodeIdEqual(benchmark::State& state) {
+    const auto lhs = makeNodeId(state.range(0) != 0);
+    const auto rhs = makeNodeId(state.range(0) != 0);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lhs == rhs);
+    }
+}
+
+BENCHMARK(nodeIdEqual)->ArgName("string")->Arg(0)->Arg(1);
+
+static void nodeIdLess(benchmark::State& state) {
+    const auto lhs = makeNodeId(state.range(0) != 0);
+    const auto rhs = makeNodeId(state.range(0) != 0);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lhs < rhs);
+    }
+}
+
+BENCHMARK(nodeIdLess)->ArgName("string")->Arg(0)->Arg(1);
+
+/* ------------------------------------------ Variant ------------------------------------------- */
+
+template <typename T>
+static T makeValue() {
+    if constexpr (std::is_same_v<T, std::string>) {
+        return "Objects.Device.Sensors.Temperature";
+    } else {
+        return T{11};
+    }
+}
+
+template <typename T>
+static void variantAssignScalar(benchmark::State& state) {
+    const auto value = makeValue<T>();
+    Variant var;
+    for (auto _ : state) {
+        var.assign(value);
+        benchmark::DoNotOptimize(var);
+    }
+}
+
+BENCHMARK_TEMPLATE(variantAssignScalar, int32_t);
+BENCHMARK_TEMPLATE(variantAssignScalar, double);
+BENCHMARK_TEMPLATE(variantAssignScalar, std::string);
+
+template <typename T>
+static void variantToScalar(benchmark::State& state) {
+    const Variant var{makeValue<T>()};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(var.to<T>());
+    }
+}
+
+BENCHMARK_TEMPLATE(variantToScalar, int32_t);
+BENCHMARK_TEMPLATE(variantToScalar, double);
+BENCHMARK_TEMPLATE(variantToScalar, std::string);
+
+template <typename T>
+static void variantAssignArray(benchmark::State& state) {
+    const std::vector<T> values(static_cast<size_t>(state.range(0)), makeValue<T>());
+    Variant var;
+    for (auto _ : state) {
+        var.assign(values);
+        benchmark::DoNotOptimize(var);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(variantAssignArray, int32_t)->RangeMultiplier(16)->Range(1, 1 << 16);
+BENCHMARK_TEMPLATE(variantAssignArray, double)->RangeMultiplier(16)->Range(1, 1 << 16);
+BENCHMARK_TEMPLATE(variantAssignArray, std::string)->RangeMultiplier(16)->Range(1, 1 << 16);
+
+template <typename T>
+static void variantToArray(benchmark::State& state) {
+    const Variant var{std::vector<T>(static_cast<size_t>(state.range(0)), makeValue<T>())};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(var.to<std::vector<T>>());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(variantToArray, int32_t)->RangeMultiplier(16)->Range(1, 1 << 16);
+BENCHMARK_TEMPLATE(variantToArray, double)->RangeMultiplier(16)->Range(1, 1 << 16);
+BENCHMARK_TEMPLATE(variantToArray, std::string)->RangeMultiplier(16)->Range(1, 1 << 16);
+
+/* ----------------------------------------- DataValue ------------------------------------------ */
+
+static DataValue makeDataValue(size_t arrayLength) {
+    DataValue dv{Variant{std::vector<double>(arrayLength, 11.11)}};
+    dv.setSourceTimestamp(DateTime::now());
+    dv.setServerTimestamp(DateTime::now());
+    dv.setStatus(UA_STATUSCODE_GOOD);
+    return dv;
+}
+
+static void dataValueCopy(benchmark::State& state) {
+    const auto src = makeDataValue(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        DataValue dst{src};
+        benchmark::DoNotOptimize(dst);
+    }
+}
+
+BENCHMARK(dataValueCopy)->RangeMultiplier(16)->Range(1, 1 << 16);
+
+static void dataValueMove(benchmark::State& state) {
+    auto src = makeDataValue(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        DataValue dst{std::move(src)};
+        benchmark::DoNotOptimize(dst);
+        src = std::move(dst);
+    }
+}
+
+BENCHMARK(dataValueMove)->RangeMultiplier(16)->Range(1, 1 << 16);
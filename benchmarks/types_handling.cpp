@@ -0,0 +1,71 @@
+#include <type_traits>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "open62541pp/detail/types_handling.hpp"
+#include "open62541pp/types.hpp"
+
+using namespace opcua;
+
+template <typename T>
+static std::vector<T> makeArray(size_t size) {
+    if constexpr (std::is_same_v<T, UA_String>) {
+        return std::vector<T>(size, UA_STRING_STATIC("Objects.Device.Sensors.Temperature"));
+    } else if constexpr (std::is_same_v<T, UA_NodeId>) {
+        return std::vector<T>(size, UA_NODEID_STRING(1, const_cast<char*>("Temperature")));
+    } else {
+        return std::vector<T>(size, T{11});
+    }
+}
+
+template <typename T>
+static void copyArrayPointer(benchmark::State& state, const UA_DataType& type) {
+    const auto size = static_cast<size_t>(state.range(0));
+    const auto src = makeArray<T>(size);
+    for (auto _ : state) {
+        T* dst = detail::copyArray(src.data(), src.size(), type);
+        benchmark::DoNotOptimize(dst);
+        detail::deallocateArray(dst, size, type);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+// pointer-free types are copied with memcpy
+BENCHMARK_CAPTURE(copyArrayPointer<UA_Int32>, Int32, UA_TYPES[UA_TYPES_INT32])
+    ->RangeMultiplier(16)
+    ->Range(1, 1 << 16);
+BENCHMARK_CAPTURE(copyArrayPointer<UA_Double>, Double, UA_TYPES[UA_TYPES_DOUBLE])
+    ->RangeMultiplier(16)
+    ->Range(1, 1 << 16);
+BENCHMARK_CAPTURE(copyArrayPointer<UA_Guid>, Guid, UA_TYPES[UA_TYPES_GUID])
+    ->RangeMultiplier(16)
+    ->Range(1, 1 << 16);
+
+// non-pointer-free types are copied element-wise with UA_copy
+BENCHMARK_CAPTURE(copyArrayPointer<UA_String>, String, UA_TYPES[UA_TYPES_STRING])
+    ->RangeMultiplier(16)
+    ->Range(1, 1 << 16);
+BENCHMARK_CAPTURE(copyArrayPointer<UA_NodeId>, NodeId, UA_TYPES[UA_TYPES_NODEID])
+    ->RangeMultiplier(16)
+    ->Range(1, 1 << 16);
+
+template <typename T>
+static void copyArrayIterator(benchmark::State& state, const UA_DataType& type) {
+    const auto size = static_cast<size_t>(state.range(0));
+    const auto src = makeArray<T>(size);
+    for (auto _ : state) {
+        auto [dst, dstSize] = detail::copyArray(src.begin(), src.end(), type);
+        benchmark::DoNotOptimize(dst);
+        detail::deallocateArray(dst, dstSize, type);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_CAPTURE(copyArrayIterator<UA_Double>, Double, UA_TYPES[UA_TYPES_DOUBLE])
+    ->RangeMultiplier(16)
+    ->Range(1, 1 << 16);
+BENCHMARK_CAPTURE(copyArrayIterator<UA_String>, String, UA_TYPES[UA_TYPES_STRING])
+    ->RangeMultiplier(16)
+    ->Range(1, 1 << 16);
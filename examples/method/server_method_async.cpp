@@ -1,6 +1,4 @@
-#include <chrono>
-#include <iostream>
-#include <thread>
+#include <string>
 
 #include <open62541pp/server.hpp>
 #include <open62541pp/services/nodemanagement.hpp>
@@ -32,19 +30,8 @@ int main() {
     // This will queue the method call operations to be processed in a worker thread
     opcua::useAsyncOperation(server, methodId, true);
 
-    // Process async operations in a separate worker thread
-    std::thread workerThread{[&server]() {
-        while (true) {
-            const auto operation = opcua::getAsyncOperation(server);
-            if (operation.has_value()) {
-                opcua::runAsyncOperation(server, operation.value());
-                std::cout << "Async operation processed\n";
-            } else {
-                std::this_thread::sleep_for(std::chrono::milliseconds{10});
-            }
-        }
-    }};
+    // Process async operations in worker threads owned by the server
+    opcua::enableAsyncOperationWorkers(server, 4);
 
     server.run();
-    workerThread.join();
 }
@@ -0,0 +1,182 @@
+#pragma once
+
+#include <cstddef>  // size_t
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>  // forward, move
+#include <vector>
+
+#include "open62541pp/async.hpp"
+#include "open62541pp/bitmask.hpp"
+#include "open62541pp/common.hpp"  // NodeClass
+#include "open62541pp/span.hpp"
+#include "open62541pp/types.hpp"
+#include "open62541pp/ua/nodeids.hpp"
+#include "open62541pp/ua/types.hpp"
+
+namespace opcua {
+
+class Client;
+
+/// Node discovered by the AddressSpaceCrawler.
+struct CrawledNode {
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+    size_t index;  ///< Index in order of discovery (start nodes first)
+    size_t parentIndex;  ///< Index of the node it was discovered from, `npos` for start nodes
+    uint32_t depth;  ///< Number of references from the start node
+    NodeId nodeId;
+    NodeId referenceTypeId;  ///< Reference type from the parent, null for start nodes
+    NodeClass nodeClass;  ///< NodeClass::Unspecified for start nodes
+    QualifiedName browseName;  ///< Empty for start nodes
+};
+
+/// Options of the AddressSpaceCrawler.
+struct AddressSpaceCrawlerOptions {
+    /// Browse direction of the followed references.
+    BrowseDirection browseDirection = BrowseDirection::Forward;
+    /// Type of the followed references.
+    NodeId referenceTypeId = ReferenceTypeId::HierarchicalReferences;
+    /// Follow subtypes of `referenceTypeId`.
+    bool includeSubtypes = true;
+    /// Report only nodes of the given node classes (all if NodeClass::Unspecified).
+    /// Nodes of other classes are traversed but not reported.
+    Bitmask<NodeClass> nodeClassMask = NodeClass::Unspecified;
+    /// Maximum depth from the start nodes (0 if no limit).
+    uint32_t maxDepth = 0;
+    /// Maximum number of nodes per Browse request, see services::BrowseAllOptions.
+    size_t maxNodesPerRequest = 0;
+    /// Maximum number of Browse/BrowseNext requests in flight per level.
+    size_t maxRequestsInFlight = 4;
+};
+
+/// Statistics of a crawl.
+struct CrawlStatistics {
+    size_t discoveredNodes;  ///< Number of unique nodes, including start nodes and filtered nodes
+    size_t reportedNodes;  ///< Number of nodes passed to the callback
+    size_t browseErrors;  ///< Number of nodes that could not be browsed
+};
+
+/**
+ * Breadth-first traversal of the address space (client only).
+ *
+ * All nodes of a level are browsed with batched and pipelined Browse/BrowseNext requests (see
+ * services::browseAll for multiple nodes), hence the number of round trips grows with the depth
+ * of the address space instead of the number of nodes. Nodes are visited only once, remote nodes
+ * (ExpandedNodeId with server index) are not followed.
+ *
+ * Discovered nodes are streamed to a callback, e.g. an AddressSpaceSnapshotWriter to store them
+ * in a compact binary file.
+ *
+ * @code
+ * opcua::AddressSpaceCrawler crawler{client};
+ * std::ofstream file{"addressspace.bin", std::ios::binary};
+ * opcua::AddressSpaceSnapshotWriter writer{file};
+ * crawler.crawl({opcua::NodeId{opcua::ObjectId::ObjectsFolder}}, writer);
+ * @endcode
+ */
+class AddressSpaceCrawler {
+public:
+    using Callback = std::function<void(CrawledNode& node)>;
+
+    explicit AddressSpaceCrawler(Client& connection, AddressSpaceCrawlerOptions options = {})
+        : connection_{connection},
+          options_{std::move(options)} {}
+
+    const AddressSpaceCrawlerOptions& options() const noexcept {
+        return options_;
+    }
+
+    /**
+     * Crawl the address space from the given start nodes.
+     * The client is iterated until the crawl is complete.
+     * @param startNodes Nodes to start from
+     * @param callback Callback to receive the discovered nodes
+     */
+    CrawlStatistics crawl(Span<const NodeId> startNodes, const Callback& callback);
+
+    /**
+     * @copydoc crawl
+     * The crawler must outlive the operation.
+     * @param token @completiontoken{void(CrawlStatistics&)}
+     * @return @asyncresult{CrawlStatistics}
+     */
+    template <typename CompletionToken>
+    auto crawlAsync(Span<const NodeId> startNodes, Callback callback, CompletionToken&& token) {
+        return asyncInitiate<CrawlStatistics>(
+            [this](
+                auto&& handler,
+                const std::vector<NodeId>& innerStartNodes,
+                Callback innerCallback
+            ) {
+                // std::function requires copyable handlers
+                auto sharedHandler = std::make_shared<std::decay_t<decltype(handler)>>(
+                    std::forward<decltype(handler)>(handler)
+                );
+                crawlAsyncImpl(
+                    innerStartNodes,
+                    std::move(innerCallback),
+                    [sharedHandler](CrawlStatistics& statistics) {
+                        std::invoke(*sharedHandler, statistics);
+                    }
+                );
+            },
+            std::forward<CompletionToken>(token),
+            std::vector<NodeId>(startNodes.begin(), startNodes.end()),  // owned by deferred ops
+            std::move(callback)
+        );
+    }
+
+private:
+    using CompletionHandler = std::function<void(CrawlStatistics&)>;
+
+    void crawlAsyncImpl(
+        Span<const NodeId> startNodes, Callback callback, CompletionHandler handler
+    );
+
+    Client& connection_;
+    AddressSpaceCrawlerOptions options_;
+};
+
+/* --------------------------------------- Snapshot files --------------------------------------- */
+
+/**
+ * Write crawled nodes to a compact binary snapshot.
+ *
+ * The snapshot starts with a header, followed by a record per node. Integers are encoded as
+ * variable-length quantities, identifiers and names as length-prefixed bytes.
+ * The writer can be passed as callback to AddressSpaceCrawler::crawl.
+ * @see readAddressSpaceSnapshot
+ */
+class AddressSpaceSnapshotWriter {
+public:
+    /// Create writer and write the snapshot header.
+    /// The stream must be opened in binary mode.
+    explicit AddressSpaceSnapshotWriter(std::ostream& stream);
+
+    /// Write a node record.
+    void write(const CrawledNode& node);
+
+    void operator()(CrawledNode& node) {
+        write(node);
+    }
+
+private:
+    std::ostream* stream_;
+};
+
+/**
+ * Read a snapshot written by AddressSpaceSnapshotWriter.
+ * @param stream Input stream, opened in binary mode
+ * @param callback Callback invoked for each node record
+ * @exception BadStatus (BadDecodingError) If the snapshot is invalid
+ */
+void readAddressSpaceSnapshot(
+    std::istream& stream, const std::function<void(CrawledNode& node)>& callback
+);
+
+}  // namespace opcua
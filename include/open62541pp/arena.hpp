@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "open62541pp/config.hpp"
+
+#if UAPP_HAS_ARENA
+
+namespace opcua {
+
+/**
+ * Scoped monotonic arena for open62541 heap allocations.
+ *
+ * While an ArenaScope is alive, all allocations of the current thread that go through the
+ * open62541 allocator (`UA_malloc`, `UA_calloc`, `UA_realloc`) are served from large memory blocks
+ * owned by the arena. This covers the wrapper types (String, NodeId, Variant, ...) and the generic
+ * type and array handling. Deallocations of arena memory are no-ops; the memory is released in one
+ * shot when the scope is destroyed.
+ * Deallocations of memory allocated outside of the arena are forwarded to the previous allocator.
+ *
+ * Scopes can be nested, the innermost scope serves the allocations.
+ *
+ * @code
+ * {
+ *     ArenaScope arena;
+ *     // copy/convert a large response tree, all allocations are served from the arena
+ *     std::vector<DataValue> results(response.results().begin(), response.results().end());
+ *     // process results...
+ * }  // results are released at once
+ * @endcode
+ *
+ * @warning Objects allocated within the scope must be destroyed on the same thread before the scope
+ *          ends. Do not run client/server event loops (including synchronous service calls) within
+ *          the scope, memory of long-living internal structures would be released with the arena.
+ * @note Only available if open62541 is compiled with `UA_ENABLE_MALLOC_SINGLETON`.
+ */
+class ArenaScope {
+public:
+    /// Create an arena and activate it for the current thread.
+    /// @param blockSize Size of the first memory block in bytes, subsequent blocks grow geometrically
+    explicit ArenaScope(size_t blockSize = 64 * 1024);
+
+    ~ArenaScope();
+
+    ArenaScope(const ArenaScope&) = delete;
+    ArenaScope(ArenaScope&&) noexcept = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+    ArenaScope& operator=(ArenaScope&&) noexcept = delete;
+
+    /// Number of bytes allocated from the arena.
+    size_t bytesAllocated() const noexcept {
+        return bytesAllocated_;
+    }
+
+    /// Number of bytes reserved by the memory blocks of the arena.
+    size_t bytesReserved() const noexcept {
+        return bytesReserved_;
+    }
+
+    /// Return `true` if the memory pointed to by `ptr` is owned by the arena.
+    bool owns(const void* ptr) const noexcept;
+
+private:
+    struct Block {
+        std::unique_ptr<std::byte[]> data;  // NOLINT(*-avoid-c-arrays)
+        size_t size;
+    };
+
+    void* allocate(size_t size) noexcept;
+    void* reallocate(void* ptr, size_t size) noexcept;
+
+    static void* mallocNative(size_t size);
+    static void* callocNative(size_t nelem, size_t elsize);
+    static void* reallocNative(void* ptr, size_t size);
+    static void freeNative(void* ptr);
+
+    ArenaScope* parent_;
+    size_t nextBlockSize_;
+    std::vector<Block> blocks_;
+    std::byte* cursor_{nullptr};
+    std::byte* end_{nullptr};
+    size_t bytesAllocated_{0};
+    size_t bytesReserved_{0};
+};
+
+}  // namespace opcua
+
+#endif  // if UAPP_HAS_ARENA
@@ -0,0 +1,224 @@
+#pragma once
+
+/**
+ * @file
+ * Optional integration with Asio (https://think-async.com/Asio).
+ * This header is not included by `open62541pp.hpp` and requires Asio in the include path.
+ *
+ * Standalone Asio (`<asio.hpp>`) is used by default. Define `UAPP_ASIO_BOOST` before including
+ * this header to use Boost.Asio (`<boost/asio.hpp>`) instead.
+ * Requirements:
+ * - Asio 1.18 (Boost 1.74) for AsioClientRunner and plain Asio completion handlers
+ * - Asio 1.22 (Boost 1.78) for the `deferred` and `experimental::use_promise` tokens
+ * - C++20 coroutine support of Asio for the `use_awaitable` token
+ */
+
+#include <chrono>
+#include <functional>  // invoke
+#include <memory>
+#include <type_traits>
+#include <utility>  // forward, move
+
+#ifdef UAPP_ASIO_BOOST
+#include <boost/asio.hpp>
+#define UAPP_ASIO_VERSION BOOST_ASIO_VERSION
+#if defined(BOOST_ASIO_HAS_CO_AWAIT)
+#define UAPP_ASIO_HAS_CO_AWAIT 1
+#endif
+#if UAPP_ASIO_VERSION >= 102200  // 1.22.0
+#include <boost/asio/experimental/use_promise.hpp>
+#endif
+#else
+#include <asio.hpp>
+#define UAPP_ASIO_VERSION ASIO_VERSION
+#if defined(ASIO_HAS_CO_AWAIT)
+#define UAPP_ASIO_HAS_CO_AWAIT 1
+#endif
+#if UAPP_ASIO_VERSION >= 102200  // 1.22.0
+#include <asio/experimental/use_promise.hpp>
+#endif
+#endif
+
+#include "open62541pp/async.hpp"
+#include "open62541pp/client.hpp"
+
+namespace opcua {
+
+namespace detail {
+
+#ifdef UAPP_ASIO_BOOST
+namespace asio = ::boost::asio;
+#else
+namespace asio = ::asio;
+#endif
+
+/**
+ * Initiate an async operation with an Asio completion token.
+ * The result is posted to the associated executor of the Asio completion handler, instead of
+ * invoking the handler within Client::runIterate. The executor is kept busy (outstanding work)
+ * until the operation completed.
+ */
+template <typename T, typename Initiation, typename AsioToken, typename... Args>
+auto asioInitiate(Initiation&& initiation, AsioToken&& token, Args&&... args) {
+    auto asioToken = std::forward<AsioToken>(token);
+    return asio::async_initiate<decltype(asioToken), void(T)>(
+        [](auto&& handler, auto&& innerInitiation, auto&&... innerArgs) {
+            using Handler = std::decay_t<decltype(handler)>;
+            auto work = asio::prefer(
+                asio::get_associated_executor(handler),
+                asio::execution::outstanding_work.tracked
+            );
+            std::invoke(
+                std::forward<decltype(innerInitiation)>(innerInitiation),
+                [asioHandler = Handler{std::forward<decltype(handler)>(handler)},
+                 work = std::move(work)](T& result) mutable {
+                    asio::post(
+                        work,
+                        [asioHandler = std::move(asioHandler),
+                         innerResult = std::move(result)]() mutable {
+                            std::move(asioHandler)(std::move(innerResult));
+                        }
+                    );
+                },
+                std::forward<decltype(innerArgs)>(innerArgs)...
+            );
+        },
+        asioToken,
+        std::forward<Initiation>(initiation),
+        std::forward<Args>(args)...
+    );
+}
+
+}  // namespace detail
+
+#if UAPP_ASIO_VERSION >= 102200  // 1.22.0
+template <typename T>
+struct AsyncResult<detail::asio::deferred_t, T> {
+    template <typename Initiation, typename... Args>
+    static auto initiate(Initiation&& initiation, detail::asio::deferred_t token, Args&&... args) {
+        return detail::asioInitiate<T>(
+            std::forward<Initiation>(initiation), token, std::forward<Args>(args)...
+        );
+    }
+};
+
+template <typename Allocator, typename T>
+struct AsyncResult<detail::asio::experimental::use_promise_t<Allocator>, T> {
+    template <typename Initiation, typename... Args>
+    static auto initiate(
+        Initiation&& initiation,
+        const detail::asio::experimental::use_promise_t<Allocator>& token,
+        Args&&... args
+    ) {
+        return detail::asioInitiate<T>(
+            std::forward<Initiation>(initiation), token, std::forward<Args>(args)...
+        );
+    }
+};
+#endif
+
+#if defined(UAPP_ASIO_HAS_CO_AWAIT)
+template <typename Executor, typename T>
+struct AsyncResult<detail::asio::use_awaitable_t<Executor>, T> {
+    template <typename Initiation, typename... Args>
+    static auto initiate(
+        Initiation&& initiation,
+        const detail::asio::use_awaitable_t<Executor>& token,
+        Args&&... args
+    ) {
+        return detail::asioInitiate<T>(
+            std::forward<Initiation>(initiation), token, std::forward<Args>(args)...
+        );
+    }
+};
+#endif
+
+/* -------------------------------------- AsioClientRunner -------------------------------------- */
+
+/**
+ * Drive the client's main loop from an Asio executor, replacing the blocking Client::run.
+ *
+ * Client::runIterate is called without blocking on each tick of a steady timer. Completion
+ * handlers of @ref useAwaitable or plain callbacks are thus invoked on the executor; results of
+ * Asio completion tokens are posted to the token's associated executor.
+ * Exceptions of Client::runIterate (e.g. from completion handlers) stop the runner and are
+ * rethrown from the Asio run function (e.g. `asio::io_context::run`).
+ *
+ * The runner must outlive the Asio executor run loop or be stopped before it is destroyed.
+ * @note open62541 does not expose the client socket, hence the client is polled with the given
+ *       interval. The interval is the maximum latency to process a response.
+ */
+class AsioClientRunner {
+public:
+    using Duration = std::chrono::steady_clock::duration;
+
+    template <typename Executor>
+    AsioClientRunner(
+        Client& client, const Executor& executor, Duration interval = std::chrono::milliseconds{1}
+    )
+        : state_{std::make_shared<State>(client, executor, interval)} {}
+
+    ~AsioClientRunner() {
+        stop();
+    }
+
+    AsioClientRunner(const AsioClientRunner&) = delete;
+    AsioClientRunner(AsioClientRunner&&) noexcept = default;
+    AsioClientRunner& operator=(const AsioClientRunner&) = delete;
+    AsioClientRunner& operator=(AsioClientRunner&&) noexcept = default;
+
+    /// Start polling the client on the executor.
+    void start() {
+        if (state_ != nullptr && !state_->running) {
+            state_->running = true;
+            schedule(state_, Duration::zero());
+        }
+    }
+
+    /// Stop polling the client. Pending timer callbacks are cancelled.
+    void stop() {
+        if (state_ != nullptr) {
+            state_->running = false;
+            state_->timer.cancel();
+        }
+    }
+
+    bool isRunning() const noexcept {
+        return state_ != nullptr && state_->running;
+    }
+
+private:
+    struct State {
+        template <typename Executor>
+        State(Client& clientRef, const Executor& executor, Duration pollInterval)
+            : client{clientRef},
+              timer{executor},
+              interval{pollInterval} {}
+
+        Client& client;
+        detail::asio::steady_timer timer;
+        Duration interval;
+        bool running{false};
+    };
+
+    static void schedule(const std::shared_ptr<State>& state, Duration delay) {
+        state->timer.expires_after(delay);
+        state->timer.async_wait([weakState = std::weak_ptr<State>{state}](const auto& ec) {
+            const auto lockedState = weakState.lock();
+            if (ec || lockedState == nullptr || !lockedState->running) {
+                return;
+            }
+            try {
+                lockedState->client.runIterate(0);
+            } catch (...) {
+                lockedState->running = false;
+                throw;
+            }
+            schedule(lockedState, lockedState->interval);
+        });
+    }
+
+    std::shared_ptr<State> state_;
+};
+
+}  // namespace opcua
@@ -4,10 +4,20 @@
 #include <future>
 #include <tuple>
 #include <type_traits>
-#include <utility>  // forward, move
+#include <utility>  // exchange, forward, move
 
+#include "open62541pp/config.hpp"
 #include "open62541pp/types.hpp"  // StatusCode
 
+#if UAPP_HAS_COROUTINES
+#include <atomic>
+#include <coroutine>
+#include <exception>  // exception_ptr
+#include <optional>
+
+#include "open62541pp/exception.hpp"
+#endif
+
 namespace opcua {
 
 /**
@@ -138,6 +148,329 @@ struct AsyncResult<UseDetachedToken, T> {
     }
 };
 
+/* ------------------------------------------ Awaitable ----------------------------------------- */
+
+#if UAPP_HAS_COROUTINES
+/**
+ * Awaitable result of an asynchronous operation, see @ref useAwaitable.
+ *
+ * The operation is initiated on construction. The awaitable lives in the coroutine frame and
+ * stores the result itself, the completion handler only holds a pointer to it (no allocation per
+ * operation). The awaitable and the handler are linked to each other: if the awaiting coroutine
+ * is destroyed while the operation is pending (e.g. the Task is destroyed), the handler is
+ * detached, the result is discarded and the coroutine is not resumed.
+ * The awaiting coroutine is resumed by the completion handler, e.g. from within Client::runIterate.
+ *
+ * The awaitable is neither copyable nor movable, typically used with
+ * `co_await op(..., useAwaitable)`.
+ * If the operation could not be initiated, `co_await` throws a BadStatus exception.
+ *
+ * @note The awaitable must be destroyed on the thread that completes the operation (the thread
+ *       driving the client), otherwise the destruction might race with the completion.
+ */
+template <typename T>
+class Awaitable {
+public:
+    template <
+        typename Initiation,
+        typename... Args,
+        typename = std::enable_if_t<!std::is_same_v<std::decay_t<Initiation>, Awaitable>>>
+    explicit Awaitable(Initiation&& initiation, Args&&... args) {
+        std::invoke(
+            std::forward<Initiation>(initiation), Handler{this}, std::forward<Args>(args)...
+        );
+    }
+
+    ~Awaitable() {
+        // don't resume the awaiting coroutine if the operation completes after its destruction
+        if (handler_ != nullptr) {
+            handler_->awaitable_ = nullptr;
+        }
+    }
+
+    Awaitable(const Awaitable&) = delete;
+    Awaitable(Awaitable&&) = delete;
+    Awaitable& operator=(const Awaitable&) = delete;
+    Awaitable& operator=(Awaitable&&) = delete;
+
+    bool await_ready() const noexcept {
+        return state_.load(std::memory_order_acquire) == State::Done;
+    }
+
+    bool await_suspend(std::coroutine_handle<> handle) noexcept {
+        handle_ = handle;
+        auto expected = State::Pending;
+        // don't suspend if the operation completed in the meantime
+        return state_.compare_exchange_strong(
+            expected, State::Suspended, std::memory_order_acq_rel
+        );
+    }
+
+    T await_resume() {
+        if (!result_.has_value()) {
+            throw BadStatus{UA_STATUSCODE_BADINTERNALERROR};  // operation was not initiated
+        }
+        return std::move(*result_);
+    }
+
+private:
+    enum class State { Pending, Suspended, Done };
+
+    class Handler {
+    public:
+        explicit Handler(Awaitable* awaitable) noexcept
+            : awaitable_{awaitable} {
+            awaitable_->handler_ = this;
+        }
+
+        ~Handler() {
+            if (awaitable_ != nullptr) {
+                detach()->complete();  // destroyed without result
+            }
+        }
+
+        Handler(const Handler&) = delete;
+        Handler& operator=(const Handler&) = delete;
+        Handler& operator=(Handler&&) = delete;
+
+        Handler(Handler&& other) noexcept
+            : awaitable_{std::exchange(other.awaitable_, nullptr)} {
+            if (awaitable_ != nullptr) {
+                awaitable_->handler_ = this;  // follow the handler to its new address
+            }
+        }
+
+        template <typename U>
+        void operator()(U&& result) {
+            if (awaitable_ == nullptr) {
+                return;  // abandoned
+            }
+            auto* awaitable = detach();
+            awaitable->result_.emplace(std::forward<U>(result));
+            awaitable->complete();  // the resumption might destroy the awaitable
+        }
+
+    private:
+        friend class Awaitable;
+
+        Awaitable* detach() noexcept {
+            awaitable_->handler_ = nullptr;
+            return std::exchange(awaitable_, nullptr);
+        }
+
+        Awaitable* awaitable_;
+    };
+
+    void complete() noexcept {
+        const auto previous = state_.exchange(State::Done, std::memory_order_acq_rel);
+        if (previous == State::Suspended) {
+            handle_.resume();
+        }
+    }
+
+    std::atomic<State> state_{State::Pending};
+    std::coroutine_handle<> handle_;
+    std::optional<T> result_;
+    Handler* handler_{nullptr};  // linked handler, nullptr once completed or destroyed
+};
+
+/**
+ * Awaitable completion token type.
+ * A completion token that causes an asynchronous operation to return an @ref Awaitable.
+ * Requires C++20 coroutines (`UAPP_HAS_COROUTINES`).
+ */
+struct UseAwaitableToken {};
+
+/**
+ * Awaitable completion token object.
+ *
+ * @code
+ * opcua::Task<void> readTemperature(opcua::Client& client) {
+ *     const auto dv = co_await opcua::services::readValueAsync(client, id, opcua::useAwaitable);
+ *     // ...
+ * }
+ * @endcode
+ * @see UseAwaitableToken
+ */
+inline constexpr UseAwaitableToken useAwaitable;
+
+template <typename T>
+struct AsyncResult<UseAwaitableToken, T> {
+    template <typename Initiation, typename... Args>
+    static Awaitable<T> initiate(
+        Initiation&& initiation, UseAwaitableToken /* unused */, Args&&... args
+    ) {
+        // guaranteed copy elision, the awaitable is constructed in place
+        return Awaitable<T>(std::forward<Initiation>(initiation), std::forward<Args>(args)...);
+    }
+};
+
+namespace detail {
+
+template <typename T>
+struct TaskPromiseResult {
+    template <typename U>
+    void return_value(U&& value) {
+        result.emplace(std::forward<U>(value));
+    }
+
+    T get() {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+        return std::move(*result);
+    }
+
+    std::optional<T> result;
+    std::exception_ptr exception;
+};
+
+template <>
+struct TaskPromiseResult<void> {
+    void return_void() noexcept {}
+
+    void get() const {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+
+    std::exception_ptr exception;
+};
+
+}  // namespace detail
+
+/**
+ * Lazily started coroutine task to await asynchronous operations with @ref useAwaitable.
+ *
+ * Tasks can be awaited by other tasks. A top-level task is started with Task::start and driven
+ * by the client's main loop (Client::runIterate or Client::run), that resumes the task whenever
+ * an awaited operation completes:
+ *
+ * @code
+ * auto task = readTemperature(client);
+ * task.start();
+ * while (!task.done()) {
+ *     client.runIterate();
+ * }
+ * task.result();  // rethrows exceptions of the coroutine
+ * @endcode
+ */
+template <typename T = void>
+class [[nodiscard]] Task {
+public:
+    struct promise_type : detail::TaskPromiseResult<T> {
+        Task get_return_object() noexcept {
+            return Task{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        std::suspend_always initial_suspend() noexcept {
+            return {};
+        }
+
+        auto final_suspend() noexcept {
+            struct FinalAwaiter {
+                bool await_ready() noexcept {
+                    return false;
+                }
+
+                std::coroutine_handle<> await_suspend(
+                    std::coroutine_handle<promise_type> handle
+                ) noexcept {
+                    auto continuation = handle.promise().continuation;
+                    return continuation ? continuation : std::noop_coroutine();
+                }
+
+                void await_resume() noexcept {}
+            };
+
+            return FinalAwaiter{};
+        }
+
+        void unhandled_exception() noexcept {
+            this->exception = std::current_exception();
+        }
+
+        std::coroutine_handle<> continuation;
+    };
+
+    Task(const Task&) = delete;
+
+    Task(Task&& other) noexcept
+        : handle_{std::exchange(other.handle_, {})},
+          started_{other.started_} {}
+
+    Task& operator=(const Task&) = delete;
+
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            destroy();
+            handle_ = std::exchange(other.handle_, {});
+            started_ = other.started_;
+        }
+        return *this;
+    }
+
+    ~Task() {
+        destroy();
+    }
+
+    /// Start the task if not started yet. Runs until the first suspension.
+    void start() {
+        if (handle_ && !started_) {
+            started_ = true;
+            handle_.resume();
+        }
+    }
+
+    /// Check if the task completed.
+    bool done() const noexcept {
+        return !handle_ || handle_.done();
+    }
+
+    /// Get the result of a completed task or rethrow its exception.
+    T result() {
+        return handle_.promise().get();
+    }
+
+    auto operator co_await() && noexcept {
+        struct Awaiter {
+            bool await_ready() noexcept {
+                return handle.done();
+            }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+                handle.promise().continuation = awaiting;
+                // start the task with symmetric transfer, unless it was started before
+                return start ? std::coroutine_handle<>{handle} : std::noop_coroutine();
+            }
+
+            T await_resume() {
+                return handle.promise().get();
+            }
+
+            std::coroutine_handle<promise_type> handle;
+            bool start;
+        };
+
+        return Awaiter{handle_, !std::exchange(started_, true)};
+    }
+
+private:
+    explicit Task(std::coroutine_handle<promise_type> handle) noexcept
+        : handle_{handle} {}
+
+    void destroy() noexcept {
+        if (handle_) {
+            handle_.destroy();
+        }
+    }
+
+    std::coroutine_handle<promise_type> handle_;
+    bool started_{false};
+};
+#endif
+
 /* ------------------------------------------ Defaults ------------------------------------------ */
 
 /**
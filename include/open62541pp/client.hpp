@@ -110,6 +110,13 @@ using StateCallback = std::function<void()>;
 using InactivityCallback = std::function<void()>;
 using SubscriptionInactivityCallback = std::function<void(IntegerId subscriptionId)>;
 
+/// Storage statistics of completion handlers of async requests, see Client::handlerStatistics.
+struct HandlerStatistics {
+    size_t chunkAllocations;  ///< Number of heap allocated chunks of recycled handler slots
+    size_t heapAllocations;  ///< Number of handlers too large for a slot (heap allocated)
+    size_t slotsInUse;  ///< Number of pending async requests
+};
+
 /**
  * High-level client class.
  *
@@ -220,10 +227,49 @@ public:
     std::vector<Subscription<Client>> subscriptions();
 #endif
 
+    /**
+     * Enable or disable coalescing of concurrent single-item async requests.
+     * Async Read, Write and Call requests with a single item (e.g. from
+     * services::readAttributeAsync, services::writeAttributeAsync or services::callAsync) are
+     * buffered and merged into a single request per service. The merged requests are sent with the
+     * next call of runIterate or as soon as `maxItems` requests of a service are buffered.
+     * The merged response is split and fanned out to the completion handlers of the original
+     * requests.
+     *
+     * Requests with a custom request header (e.g. timeout hint) are not coalesced.
+     * Read requests are only merged if `maxAge` and `timestampsToReturn` are equal.
+     * If the merged request can not be sent, the completion handlers are invoked with a response
+     * containing the bad service result.
+     *
+     * The issue order of requests is kept: only requests of one service are buffered at a time,
+     * buffered requests are sent before requests of another service and before any request that
+     * is not coalesced (including sync requests).
+     * Merged requests never exceed the operation limits of the server (`MaxNodesPerRead`,
+     * `MaxNodesPerWrite`) once they are cached, e.g. by services::readValues.
+     *
+     * @param enabled Enable coalescing, buffered requests are sent if disabled
+     * @param maxItems Maximum number of items per merged request (0 = limited by the operation
+     *                 limits of the server only)
+     */
+    void setRequestCoalescing(bool enabled, size_t maxItems = 0);
+
+    /**
+     * Get the storage statistics of completion handlers.
+     * Completion handlers of async requests are stored in recycled slots. Once warmed up,
+     * `chunkAllocations` and `heapAllocations` remain constant, i.e. async requests don't allocate
+     * heap memory for their completion handlers.
+     */
+    HandlerStatistics handlerStatistics() const;
+
     /**
      * Run a single iteration of the client's main loop.
      * Listen on the network and process arriving asynchronous responses in the background.
      * Internal housekeeping, renewal of SecureChannels and subscription management is done as well.
+     *
+     * The method returns as soon as network messages were processed or the timeout expired.
+     * To drive the client from an external event loop, call `runIterate(0)` periodically (e.g.
+     * from a timer), as open62541 does not expose the client socket in the public API.
+     *
      * @param timeoutMilliseconds Timeout in milliseconds
      */
     void runIterate(uint16_t timeoutMilliseconds = 1000);
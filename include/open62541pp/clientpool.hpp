@@ -0,0 +1,157 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "open62541pp/client.hpp"
+
+namespace opcua {
+
+/// Strategy to select a member of a ClientPool.
+enum class LoadBalancing {
+    RoundRobin,  ///< Cycle through the connected members
+    LeastOutstandingRequests,  ///< Member with the fewest pending async requests
+};
+
+/**
+ * Pool of clients connected to the same server endpoint.
+ *
+ * A single session is capped by the server limits of outstanding requests, subscriptions and
+ * monitored items. The pool manages multiple clients (each with its own session) and distributes
+ * requests and monitored items across them.
+ *
+ * The clients are created with configurations of a factory function, e.g. to apply the same
+ * certificates, identity tokens and custom data types. Disconnected members are reconnected
+ * within runIterate. The pool installs the `onDisconnected` callback of its members, do not
+ * override it.
+ *
+ * Like the Client class, the pool is not thread-safe: members must only be used by the thread,
+ * that drives the pool with run or runIterate.
+ *
+ * @code
+ * opcua::ClientPool pool{4, [] {
+ *     opcua::ClientConfig config;
+ *     config.setUserIdentityToken(opcua::UserNameIdentityToken{"user", "password"});
+ *     return config;
+ * }};
+ * pool.connect("opc.tcp://localhost:4840");
+ * opcua::services::readValueAsync(pool.next(), id, [](opcua::Result<opcua::Variant>& result) {});
+ * opcua::services::createMonitoredItemDataChangeAsync(pool.nextForMonitoredItems(), ...);
+ * pool.run();
+ * @endcode
+ */
+class ClientPool {
+public:
+    using ConfigFactory = std::function<ClientConfig()>;
+
+    /**
+     * Create a pool of clients.
+     * @param size Number of clients (sessions), must be greater than 0
+     * @param configFactory Function to create the configuration of each client.
+     *                      Clients are created with the default configuration if empty.
+     * @param loadBalancing Strategy to select the member of next
+     * @exception std::invalid_argument If `size` is 0
+     */
+    explicit ClientPool(
+        size_t size,
+        const ConfigFactory& configFactory = {},
+        LoadBalancing loadBalancing = LoadBalancing::RoundRobin
+    );
+
+    ~ClientPool();
+
+    ClientPool(const ClientPool&) = delete;
+    ClientPool(ClientPool&&) noexcept = delete;
+    ClientPool& operator=(const ClientPool&) = delete;
+    ClientPool& operator=(ClientPool&&) noexcept = delete;
+
+    /// Number of members.
+    size_t size() const noexcept {
+        return members_.size();
+    }
+
+    /// Get member by index.
+    /// @exception std::out_of_range If `index` >= size()
+    Client& at(size_t index) {
+        return members_.at(index).client;
+    }
+
+    /// Number of connected members.
+    size_t connectedCount();
+
+    /**
+     * Connect all members to the server.
+     * Members that fail to connect or disconnect afterwards are reconnected within runIterate
+     * until disconnect is called.
+     * @param endpointUrl Endpoint URL (for example `opc.tcp://localhost:4840/open62541/server/`)
+     * @exception BadStatus If a member failed to connect
+     */
+    void connect(std::string_view endpointUrl);
+
+    /// Disconnect all members and stop reconnecting.
+    void disconnect();
+
+    /// Minimum interval between reconnection attempts of a member (default: 1 s).
+    void setReconnectInterval(std::chrono::milliseconds interval) noexcept {
+        reconnectInterval_ = interval;
+    }
+
+    /**
+     * Select the member for the next request, according to the LoadBalancing strategy.
+     * Disconnected members are skipped. If no member is connected, a disconnected member is
+     * returned and the request fails with the client's usual error.
+     */
+    Client& next();
+
+    /**
+     * Select the member with the fewest monitored items to create new monitored items.
+     * Disconnected members are skipped. Creating subscriptions and monitored items with the
+     * returned member spreads them across the sessions.
+     */
+    Client& nextForMonitoredItems();
+
+    /**
+     * Run a single iteration of the main loop of all members and reconnect dead members.
+     * The timeout is split between the members (at least 1 ms per member if not 0).
+     * Connection errors of dead members are not thrown, other exceptions (e.g. of completion
+     * handlers) are rethrown.
+     * @param timeoutMilliseconds Total timeout in milliseconds
+     */
+    void runIterate(uint16_t timeoutMilliseconds = 0);
+
+    /// Run the main loop of all members by calling runIterate.
+    /// This method will block until ClientPool::stop is called.
+    void run();
+
+    /// Stop the main loop.
+    void stop();
+
+    /// Check if the main loop is running.
+    bool isRunning() const noexcept {
+        return running_;
+    }
+
+private:
+    struct Member {
+        Client client;
+        bool reconnect{false};
+        bool connecting{false};  // connectAsync in progress, not reflected by isConnected
+        std::chrono::steady_clock::time_point lastAttempt{};
+    };
+
+    void reconnect(Member& member);
+
+    std::vector<Member> members_;
+    LoadBalancing loadBalancing_;
+    std::string endpointUrl_;  // empty if disconnected
+    std::chrono::milliseconds reconnectInterval_{1000};
+    size_t cursor_{0};
+    std::atomic<bool> running_{false};
+};
+
+}  // namespace opcua
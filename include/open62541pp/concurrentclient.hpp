@@ -0,0 +1,167 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <functional>  // function, invoke
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>  // forward, move
+
+#include "open62541pp/async.hpp"
+#include "open62541pp/client.hpp"
+#include "open62541pp/detail/mpscqueue.hpp"
+#include "open62541pp/detail/result_utils.hpp"
+#include "open62541pp/result.hpp"
+
+namespace opcua {
+
+namespace detail {
+
+template <typename T>
+struct IsResult : std::false_type {};
+
+template <typename T>
+struct IsResult<Result<T>> : std::true_type {};
+
+// Result of ConcurrentClient::execute, results of functions returning a Result are not nested
+template <typename F>
+auto invokeCaptured(F& func, Client& client) noexcept {
+    using ReturnType = std::invoke_result_t<F&, Client&>;
+    if constexpr (IsResult<ReturnType>::value) {
+        try {
+            return std::invoke(func, client);
+        } catch (...) {
+            return ReturnType{BadResult{getStatusCode(std::current_exception())}};
+        }
+    } else {
+        return tryInvoke(func, client);
+    }
+}
+
+}  // namespace detail
+
+/**
+ * Thread-safe client facade.
+ *
+ * The Client class is not thread-safe. ConcurrentClient owns a Client and runs its main loop on a
+ * dedicated I/O thread. Operations are submitted from any thread through a lock-free
+ * multi-producer queue and executed on the I/O thread, so callers don't contend on a mutex.
+ * Results are delivered with completion tokens, e.g. as futures (@ref useFuture) or awaitables
+ * (@ref useAwaitable). Completion handlers are invoked on the I/O thread.
+ *
+ * @code
+ * opcua::ConcurrentClient client;
+ * client.post([](opcua::Client& c) { c.connect("opc.tcp://localhost:4840"); });
+ * // from any thread, pipelined with other requests:
+ * auto future = client.executeAsync<opcua::Result<opcua::Variant>>(
+ *     [id](opcua::Client& c, auto&& handler) {
+ *         opcua::services::readValueAsync(c, id, std::forward<decltype(handler)>(handler));
+ *     },
+ *     opcua::useFuture
+ * );
+ * @endcode
+ */
+class ConcurrentClient {
+public:
+    using Task = std::function<void(Client&)>;
+
+    /// Create and run a client with default configuration.
+    ConcurrentClient()
+        : ConcurrentClient{Client{}} {}
+
+    /**
+     * Take ownership of a client and run its main loop on the I/O thread.
+     * @param client Client instance, must not be used by other threads anymore
+     * @param iterateTimeout Maximum time to wait for network messages, if no operations are queued.
+     *                       Queued operations are executed with a delay up to this timeout.
+     */
+    explicit ConcurrentClient(
+        Client&& client, std::chrono::milliseconds iterateTimeout = std::chrono::milliseconds{10}
+    );
+
+    /// Stop the I/O thread after all queued operations are executed.
+    ~ConcurrentClient();
+
+    ConcurrentClient(const ConcurrentClient&) = delete;
+    ConcurrentClient(ConcurrentClient&&) noexcept = delete;
+    ConcurrentClient& operator=(const ConcurrentClient&) = delete;
+    ConcurrentClient& operator=(ConcurrentClient&&) noexcept = delete;
+
+    /// Execute a function `void(Client&)` on the I/O thread.
+    /// Exceptions thrown by the function are logged.
+    void post(Task task);
+
+    /**
+     * Execute a (synchronous) function `R(Client&)` on the I/O thread and complete with its
+     * result, captured as a Result (exceptions are converted to bad status codes).
+     * @note Synchronous services block the I/O thread until the response arrived. Use
+     *       executeAsync to pipeline requests of multiple threads.
+     * @param func Function to execute
+     * @param token @completiontoken{void(Result<R>&)}
+     */
+    template <typename F, typename CompletionToken = DefaultCompletionToken>
+    auto execute(F&& func, CompletionToken&& token = DefaultCompletionToken()) {
+        using ResultType = decltype(detail::invokeCaptured(func, std::declval<Client&>()));
+        return asyncInitiate<ResultType>(
+            [this](auto&& handler, auto&& innerFunc) {
+                post([handler = makeCopyable(std::forward<decltype(handler)>(handler)),
+                      innerFunc = std::forward<decltype(innerFunc)>(innerFunc)](
+                         Client& client
+                     ) mutable {
+                    auto result = detail::invokeCaptured(innerFunc, client);
+                    std::invoke(*handler, result);
+                });
+            },
+            std::forward<CompletionToken>(token),
+            std::forward<F>(func)
+        );
+    }
+
+    /**
+     * Initiate an async operation on the I/O thread.
+     * The function `void(Client&, Handler&& handler)` is executed on the I/O thread and must
+     * initiate an async operation (e.g. services::readValueAsync), that completes with `T`.
+     * @param initiation Function to initiate the async operation
+     * @param token @completiontoken{void(T&)}
+     */
+    template <typename T, typename F, typename CompletionToken = DefaultCompletionToken>
+    auto executeAsync(F&& initiation, CompletionToken&& token = DefaultCompletionToken()) {
+        return asyncInitiate<T>(
+            [this](auto&& handler, auto&& innerInitiation) {
+                post([handler = makeCopyable(std::forward<decltype(handler)>(handler)),
+                      innerInitiation = std::forward<decltype(innerInitiation)>(innerInitiation)](
+                         Client& client
+                     ) mutable {
+                    std::invoke(innerInitiation, client, [handler](T& result) {
+                        std::invoke(*handler, result);
+                    });
+                });
+            },
+            std::forward<CompletionToken>(token),
+            std::forward<F>(initiation)
+        );
+    }
+
+    /// Check if the caller runs on the I/O thread.
+    bool isIoThread() const noexcept {
+        return std::this_thread::get_id() == thread_.get_id();
+    }
+
+private:
+    // std::function requires copyable handlers
+    template <typename Handler>
+    static auto makeCopyable(Handler&& handler) {
+        return std::make_shared<std::decay_t<Handler>>(std::forward<Handler>(handler));
+    }
+
+    void run();
+
+    Client client_;
+    std::chrono::milliseconds iterateTimeout_;
+    detail::MpscQueue<Task> queue_;
+    std::atomic<bool> stopped_{false};
+    std::thread thread_;  // started last
+};
+
+}  // namespace opcua
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <algorithm>  // max, min
+#include <atomic>
+#include <cstddef>  // size_t
+#include <cstdint>
+#include <thread>  // yield
+#include <utility>  // move, pair
+#include <vector>
+
+#include "open62541pp/config.hpp"
+#include "open62541pp/services/subscription.hpp"  // DataChangeBatchCallback
+#include "open62541pp/span.hpp"
+#include "open62541pp/types.hpp"  // DataValue, DateTime, StatusCode
+#include "open62541pp/ua/types.hpp"  // IntegerId
+
+namespace opcua {
+
+/// Behavior of DataChangeRing::push if the ring is full.
+enum class RingOverflow {
+    DropNewest,  ///< Discard the pushed item, see DataChangeRing::dropped
+    Block,  ///< Wait until the consumer has popped items (stalls the producer, e.g. the client)
+};
+
+/**
+ * Bounded lock-free single-producer single-consumer ring buffer.
+ *
+ * Hands data changes from the thread running the client to a consumer thread without locks and
+ * without allocations: items are moved into preallocated slots. The producer and consumer indices
+ * are kept on separate cache lines and each side caches the index of the other side, so the shared
+ * indices are only read if the ring appears full (producer) or empty (consumer).
+ *
+ * Use makeDataChangeSink to push the data changes of a subscription into the ring.
+ * Only a single thread may push and a single (other) thread may pop.
+ *
+ * @tparam T Item type, e.g. NumericDataChange or `std::pair<IntegerId, DataValue>`
+ */
+template <typename T>
+class DataChangeRing {
+public:
+    /// Create ring, the capacity is rounded up to the next power of two.
+    explicit DataChangeRing(size_t capacity, RingOverflow overflow = RingOverflow::DropNewest)
+        : slots_(roundUpPowerOfTwo(std::max<size_t>(capacity, 2))),
+          mask_{slots_.size() - 1},
+          overflow_{overflow} {}
+
+    DataChangeRing(const DataChangeRing&) = delete;
+    DataChangeRing(DataChangeRing&&) noexcept = delete;
+    DataChangeRing& operator=(const DataChangeRing&) = delete;
+    DataChangeRing& operator=(DataChangeRing&&) noexcept = delete;
+    ~DataChangeRing() = default;
+
+    size_t capacity() const noexcept {
+        return slots_.size();
+    }
+
+    /// Number of items, only exact if called by the producer or consumer thread while the other
+    /// side is idle.
+    size_t size() const noexcept {
+        return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+    }
+
+    /// Number of items discarded with RingOverflow::DropNewest.
+    uint64_t dropped() const noexcept {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+    /// Push an item, must only be called by the producer thread.
+    /// @return `false` if the ring is full and the item was dropped
+    bool push(T&& item) {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        while (head - tailCache_ >= slots_.size()) {
+            tailCache_ = tail_.load(std::memory_order_acquire);
+            if (head - tailCache_ < slots_.size()) {
+                break;
+            }
+            if (overflow_ == RingOverflow::DropNewest) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            std::this_thread::yield();
+        }
+        slots_[head & mask_] = std::move(item);
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Pop up to `items.size()` items, must only be called by the consumer thread.
+    /// @return Number of items moved to the front of `items`
+    size_t pop(Span<T> items) {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        if (headCache_ - tail < items.size()) {
+            headCache_ = head_.load(std::memory_order_acquire);
+        }
+        const size_t count = std::min(items.size(), headCache_ - tail);
+        for (size_t i = 0; i < count; ++i) {
+            items[i] = std::move(slots_[(tail + i) & mask_]);
+        }
+        tail_.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+private:
+    static constexpr size_t cacheLineSize = 64;
+
+    static size_t roundUpPowerOfTwo(size_t value) noexcept {
+        size_t result = 1;
+        while (result < value) {
+            result <<= 1U;
+        }
+        return result;
+    }
+
+    // producer side
+    alignas(cacheLineSize) std::atomic<size_t> head_{0};  // next slot to write
+    size_t tailCache_{0};
+    std::atomic<uint64_t> dropped_{0};  // written by the producer only
+    // consumer side
+    alignas(cacheLineSize) std::atomic<size_t> tail_{0};  // next slot to read
+    size_t headCache_{0};
+    // shared, read-only after construction
+    alignas(cacheLineSize) std::vector<T> slots_;
+    size_t mask_;
+    RingOverflow overflow_;
+};
+
+/// Compact data change record of a numeric scalar value.
+struct NumericDataChange {
+    IntegerId monitoredItemId;
+    double value;  ///< Value converted to double, NaN if the value is not a numeric scalar
+    DateTime sourceTimestamp;
+    StatusCode status;  ///< Status of the value or BadTypeMismatch if not a numeric scalar
+};
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+/**
+ * Create a batch callback that moves data changes into a ring buffer.
+ * The ring must outlive the subscription.
+ * @code
+ * opcua::DataChangeRing<opcua::NumericDataChange> ring{4096};
+ * subscription.setDataChangeBatchCallback(opcua::makeDataChangeSink(ring));
+ * // consumer thread
+ * std::array<opcua::NumericDataChange, 256> changes;
+ * const size_t count = ring.pop(changes);
+ * @endcode
+ * @see services::setDataChangeBatchCallback
+ */
+services::DataChangeBatchCallback makeDataChangeSink(
+    DataChangeRing<std::pair<IntegerId, DataValue>>& ring
+);
+
+/// @copydoc makeDataChangeSink
+/// Data changes are converted to compact NumericDataChange records.
+services::DataChangeBatchCallback makeDataChangeSink(DataChangeRing<NumericDataChange>& ring);
+
+#endif
+
+}  // namespace opcua
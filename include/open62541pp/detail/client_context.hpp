@@ -4,13 +4,17 @@
 #include <atomic>
 #include <cstdint>
 #include <functional>
+#include <optional>
 #include <utility>  // pair
+#include <vector>
 
 #include "open62541pp/config.hpp"
 #include "open62541pp/detail/contextmap.hpp"
 #include "open62541pp/detail/exceptioncatcher.hpp"
+#include "open62541pp/detail/handlerslab.hpp"
 #include "open62541pp/detail/open62541/client.h"  // UA_SessionState, UA_SecureChannelState
 #include "open62541pp/services/detail/monitoreditem_context.hpp"
+#include "open62541pp/services/detail/request_coalescer.hpp"
 #include "open62541pp/services/detail/subscription_context.hpp"
 #include "open62541pp/ua/types.hpp"  // IntegerId
 
@@ -29,6 +33,7 @@ inline constexpr size_t clientStateCount = 4;
  */
 struct ClientContext {
     ExceptionCatcher exceptionCatcher;
+    HandlerSlab handlerSlab;  // destroyed after pending requests are cancelled
     std::atomic<bool> running{false};
 
 #if UAPP_OPEN62541_VER_LE(1, 0)
@@ -39,6 +44,18 @@ struct ClientContext {
 #endif
     std::array<std::function<void()>, clientStateCount> stateCallbacks;
     std::function<void()> inactivityCallback;
+
+    /// Cached operation limits of the server (0 = no limit), reset on session activation
+    struct OperationLimits {
+        std::optional<uint32_t> maxNodesPerRead;
+        std::optional<uint32_t> maxNodesPerWrite;
+        std::optional<uint32_t> maxNodesPerBrowse;
+        std::optional<uint32_t> maxMonitoredItemsPerCall;
+    } operationLimits;
+
+    /// Buffered single-item requests, sent with the next iteration
+    services::detail::RequestCoalescer coalescer;
+
     ContextMap<uint64_t, Staleable<std::function<void()>>> callbacks;
 
 #ifdef UA_ENABLE_SUBSCRIPTIONS
@@ -47,6 +64,8 @@ struct ClientContext {
     using SubMonId = std::pair<SubId, MonId>;
     ContextMap<SubId, services::detail::SubscriptionContext> subscriptions;
     ContextMap<SubMonId, services::detail::MonitoredItemContext> monitoredItems;
+    /// Subscriptions with collected data changes, delivered after each iteration
+    std::vector<services::detail::SubscriptionContext*> pendingDataChangeBatches;
     std::function<void(IntegerId)> subscriptionInactivityCallback;
 #endif
 };
@@ -7,6 +7,7 @@ class Client;
 
 namespace detail {
 class ExceptionCatcher;
+class HandlerSlab;
 struct ClientContext;
 }  // namespace detail
 }  // namespace opcua
@@ -19,6 +20,7 @@ ClientContext* getContext(UA_Client* client) noexcept;
 ClientContext& getContext(Client& client) noexcept;
 ExceptionCatcher* getExceptionCatcher(UA_Client* client) noexcept;
 ExceptionCatcher& getExceptionCatcher(Client& client) noexcept;
+HandlerSlab& getHandlerSlab(Client& client) noexcept;
 UA_Client* getHandle(Client& client) noexcept;
 
 }  // namespace opcua::detail
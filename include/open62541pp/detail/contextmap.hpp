@@ -1,11 +1,17 @@
 #pragma once
 
-#include <functional>  // invoke
-#include <map>
+#include <algorithm>  // max
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>  // hash, invoke
+#include <limits>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace opcua::detail {
 
@@ -32,82 +38,401 @@ struct Staleable {
     T item;
 };
 
+/// Hash function for ContextMap keys, supports `std::pair` keys (e.g. subscription/monitored item).
+template <typename Key>
+struct ContextMapHash : std::hash<Key> {};
+
+template <typename T1, typename T2>
+struct ContextMapHash<std::pair<T1, T2>> {
+    size_t operator()(const std::pair<T1, T2>& pair) const noexcept {
+        const size_t h1 = ContextMapHash<T1>{}(pair.first);
+        const size_t h2 = ContextMapHash<T2>{}(pair.second);
+        return h1 ^ (h2 + 0x9e3779b9 + (h1 << 6) + (h1 >> 2));  // boost::hash_combine
+    }
+};
+
+/**
+ * Open-addressing hash map with linear probing, used for the shards of ContextMap.
+ * The (well mixed) hash of each key is passed by the caller and stored in the slots, so growing the
+ * table never rehashes the keys, e.g. NodeIds with string identifiers. Lookups are heterogeneous:
+ * any type comparable with `Key` can be used to find entries.
+ * Erased slots are refilled by shifting the following entries backwards, no tombstones are needed.
+ */
+template <typename Key, typename Value>
+class FlatHashMap {
+public:
+    using Entry = std::pair<Key, Value>;
+
+    size_t size() const noexcept {
+        return size_;
+    }
+
+    template <typename K>
+    Value* find(const K& key, size_t hash) noexcept {
+        const auto pos = findSlot(key, hash);
+        return pos < slots_.size() ? &slots_[pos].entry->second : nullptr;
+    }
+
+    template <typename K>
+    const Value* find(const K& key, size_t hash) const noexcept {
+        const auto pos = findSlot(key, hash);
+        return pos < slots_.size() ? &slots_[pos].entry->second : nullptr;
+    }
+
+    /// Insert a value-initialized value if the key does not exist.
+    template <typename K>
+    Value& tryEmplace(const K& key, size_t hash) {
+        if (auto* value = find(key, hash)) {
+            return *value;
+        }
+        return emplaceNew(Key(key), hash, Value{});
+    }
+
+    template <typename K>
+    Value& insertOrAssign(const K& key, size_t hash, Value&& value) {
+        if (auto* existing = find(key, hash)) {
+            *existing = std::move(value);
+            return *existing;
+        }
+        return emplaceNew(Key(key), hash, std::move(value));
+    }
+
+    /// Grow the table to hold `count` entries without further growing.
+    void reserve(size_t count) {
+        while (count * 4 > slots_.size() * 3) {  // max load factor 0.75
+            grow();
+        }
+    }
+
+    template <typename K>
+    size_t erase(const K& key, size_t hash) noexcept {
+        const auto pos = findSlot(key, hash);
+        if (pos < slots_.size()) {
+            eraseSlot(pos);
+            return 1;
+        }
+        return 0;
+    }
+
+    template <typename Predicate>
+    size_t eraseIf(Predicate&& pred) {  // NOLINT(cppcoreguidelines-missing-std-forward)
+        const size_t count = size_;
+        for (size_t pos = 0; pos < slots_.size();) {
+            if (slots_[pos].entry.has_value() && pred(*slots_[pos].entry)) {
+                eraseSlot(pos);  // check shifted entry at the same position again
+            } else {
+                ++pos;
+            }
+        }
+        return count - size_;
+    }
+
+    template <typename F>
+    void iterate(F&& func) const {  // NOLINT(cppcoreguidelines-missing-std-forward)
+        for (const auto& slot : slots_) {
+            if (slot.entry.has_value()) {
+                std::invoke(func, *slot.entry);
+            }
+        }
+    }
+
+private:
+    struct Slot {
+        size_t hash{0};
+        std::optional<Entry> entry;
+    };
+
+    size_t mask() const noexcept {
+        return slots_.size() - 1;
+    }
+
+    size_t homeOf(size_t hash) const noexcept {
+        return hash & mask();
+    }
+
+    // return slot position or slots_.size() if not found
+    template <typename K>
+    size_t findSlot(const K& key, size_t hash) const noexcept {
+        if (size_ == 0) {
+            return slots_.size();
+        }
+        for (size_t pos = homeOf(hash);; pos = (pos + 1) & mask()) {
+            const auto& slot = slots_[pos];
+            if (!slot.entry.has_value()) {
+                return slots_.size();
+            }
+            if (slot.hash == hash && slot.entry->first == key) {
+                return pos;
+            }
+        }
+    }
+
+    Value& emplaceNew(Key&& key, size_t hash, Value&& value) {
+        if ((size_ + 1) * 4 > slots_.size() * 3) {  // max load factor 0.75
+            grow();
+        }
+        size_t pos = homeOf(hash);
+        while (slots_[pos].entry.has_value()) {
+            pos = (pos + 1) & mask();
+        }
+        slots_[pos].hash = hash;
+        slots_[pos].entry.emplace(std::move(key), std::move(value));
+        ++size_;
+        return slots_[pos].entry->second;
+    }
+
+    void eraseSlot(size_t hole) noexcept {
+        slots_[hole].entry.reset();
+        for (size_t pos = (hole + 1) & mask(); slots_[pos].entry.has_value();
+             pos = (pos + 1) & mask()) {
+            // move entry into the hole unless its home lies cyclically in (hole, pos]
+            const size_t distHome = (pos - homeOf(slots_[pos].hash)) & mask();
+            const size_t distHole = (pos - hole) & mask();
+            if (distHome >= distHole) {
+                slots_[hole] = std::move(slots_[pos]);
+                slots_[pos].entry.reset();
+                hole = pos;
+            }
+        }
+        --size_;
+    }
+
+    void grow() {
+        std::vector<Slot> old(std::max<size_t>(16, slots_.size() * 2));
+        old.swap(slots_);
+        for (auto& slot : old) {
+            if (slot.entry.has_value()) {
+                size_t pos = homeOf(slot.hash);
+                while (slots_[pos].entry.has_value()) {
+                    pos = (pos + 1) & mask();
+                }
+                slots_[pos] = std::move(slot);
+            }
+        }
+    }
+
+    std::vector<Slot> slots_;
+    size_t size_{0};
+};
+
 /**
  * Thread-safe map for context objects.
  * Context objects are reference as `void*` pointers in open62541 functions/callbacks. To prevent
  * pointer-invalidation, the objects are stored as unique pointers.
- * Stale objects will be removed when new objects are stored in the map.
+ *
+ * The map is split into shards of open-addressing hash maps, each guarded by its own mutex.
+ * Lookups, insertions and deletions are O(1) on average and only lock a single shard. Keys are
+ * hashed once per operation. Lookups are heterogeneous if `Hash` and `Key` support it, e.g. NodeId
+ * keys can be found by UA_NodeId without copying.
+ * Stale objects are removed deferred: a shard is swept once the number of insertions since its
+ * last sweep reaches its size, which keeps insertions O(1) amortized. Call eraseStale to remove all
+ * stale objects immediately. Until then, stale objects are treated as removed: they are ignored by
+ * find, contains, size and iterate and replaced by operator[].
  */
-template <typename Key, typename Item>
+template <typename Key, typename Item, typename Hash = ContextMapHash<Key>>
 class ContextMap {
 public:
     /// Access or insert specified element
-    Item* operator[](Key key) {
-        eraseStale();
-        auto lock = acquireLock();
-        auto& item = map_[key];
-        if (item == nullptr) {
-            item = std::make_unique<Item>();  // allocate item if empty
+    Item* operator[](const Key& key) {
+        const auto hash = hashOf(key);
+        auto& shard = getShard(hash);
+        auto lock = acquireLock(shard);
+        auto& item = shard.map.tryEmplace(key, hash);
+        if (item != nullptr && !isStale(*item)) {
+            return item.get();
         }
-        return item.get();
+        item = std::make_unique<Item>();  // allocate item if empty or stale
+        auto* ptr = item.get();
+        onInsert(shard);  // might move the slots
+        return ptr;
     }
 
     /// Inserts an element or assigns to the current element if the key already exists
-    Item* insert(Key key, std::unique_ptr<Item>&& item) {
-        eraseStale();
-        auto lock = acquireLock();
-        return map_.insert_or_assign(key, std::move(item)).first->second.get();
+    Item* insert(const Key& key, std::unique_ptr<Item>&& item) {
+        const auto hash = hashOf(key);
+        auto& shard = getShard(hash);
+        auto lock = acquireLock(shard);
+        auto* ptr = shard.map.insertOrAssign(key, hash, std::move(item)).get();
+        onInsert(shard);
+        return ptr;
     }
 
-    size_t erase(Key key) {
-        auto lock = acquireLock();
-        return map_.erase(key);
+    /// Insert or assign multiple elements, each affected shard is locked only once.
+    void insertMany(std::vector<std::pair<Key, std::unique_ptr<Item>>>&& entries) {
+        std::vector<size_t> hashes(entries.size());
+        std::array<size_t, shardCount> counts{};
+        for (size_t i = 0; i < entries.size(); ++i) {
+            hashes[i] = hashOf(entries[i].first);
+            ++counts[shardIndexOf(hashes[i])];
+        }
+        for (size_t index = 0; index < shardCount; ++index) {
+            if (counts[index] == 0) {
+                continue;
+            }
+            auto& shard = shards_[index];
+            auto lock = acquireLock(shard);
+            shard.map.reserve(shard.map.size() + counts[index]);
+            for (size_t i = 0; i < entries.size(); ++i) {
+                if (shardIndexOf(hashes[i]) == index) {
+                    shard.map.insertOrAssign(
+                        entries[i].first, hashes[i], std::move(entries[i].second)
+                    );
+                }
+            }
+            onInsert(shard, counts[index]);
+        }
     }
 
+    size_t erase(const Key& key) {
+        const auto hash = hashOf(key);
+        auto& shard = getShard(hash);
+        auto lock = acquireLock(shard);
+        return shard.map.erase(key, hash);
+    }
+
+    /// Remove all stale objects.
     size_t eraseStale() {
-        const size_t count = map_.size();
-        if constexpr (IsStaleable<Item>::value) {
-            auto lock = acquireLock();
-            for (auto it = map_.begin(); it != map_.end();) {
-                if (it->second->stale) {
-                    it = map_.erase(it);
-                } else {
-                    ++it;
-                }
+        size_t count = 0;
+        for (auto& shard : shards_) {
+            auto lock = acquireLock(shard);
+            count += eraseStale(shard);
+        }
+        return count;
+    }
+
+    size_t size() const {
+        size_t count = 0;
+        for (const auto& shard : shards_) {
+            auto lock = acquireLock(shard);
+            if constexpr (IsStaleable<Item>::value) {
+                // stale objects are not counted, O(capacity)
+                shard.map.iterate([&](const auto& entry) {
+                    count += isStale(*entry.second) ? 0 : 1;
+                });
+            } else {
+                count += shard.map.size();
             }
         }
-        return count - map_.size();
+        return count;
     }
 
-    bool contains(Key key) const {
-        auto lock = acquireLock();
-        return map_.count(key) > 0;
+    bool contains(const Key& key) const {
+        return find(key) != nullptr;
     }
 
-    const Item* find(Key key) const {
-        auto lock = acquireLock();
-        auto it = map_.find(key);
-        if (it != map_.end()) {
-            return it->second.get();
-        }
-        return nullptr;
+    /// @overload
+    template <typename K, typename = std::enable_if_t<!std::is_convertible_v<const K&, Key>>>
+    bool contains(const K& key) const {
+        return find(key) != nullptr;
+    }
+
+    const Item* find(const Key& key) const {
+        return findImpl(key);
+    }
+
+    /// @overload
+    Item* find(const Key& key) {
+        return const_cast<Item*>(findImpl(key));  // NOLINT(*-const-cast), items are not const
+    }
+
+    /// @overload
+    template <typename K, typename = std::enable_if_t<!std::is_convertible_v<const K&, Key>>>
+    const Item* find(const K& key) const {
+        return findImpl(key);
     }
 
+    /// Invoke `func` for each element (unordered), shards are locked one after another.
     template <typename F>
     void iterate(F&& func) const {  // NOLINT(cppcoreguidelines-missing-std-forward)
-        auto lock = acquireLock();
-        for (const auto& pair : map_) {
-            std::invoke(func, pair);
+        for (const auto& shard : shards_) {
+            auto lock = acquireLock(shard);
+            shard.map.iterate([&](const auto& entry) {
+                if (!isStale(*entry.second)) {
+                    std::invoke(func, entry);
+                }
+            });
         }
     }
 
 private:
-    [[nodiscard]] auto acquireLock() const {
-        return std::scoped_lock(mutex_);
+    static constexpr size_t shardBits = 4;
+    static constexpr size_t shardCount = size_t{1} << shardBits;
+    static constexpr size_t minSweepInterval = 64;
+
+    struct Shard {
+        FlatHashMap<Key, std::unique_ptr<Item>> map;
+        size_t insertionsSinceSweep{0};
+        size_t insertionsUntilSweep{minSweepInterval};
+        mutable std::mutex mutex;
+    };
+
+    template <typename K>
+    static size_t hashOf(const K& key) noexcept {
+        // mix bits (MurmurHash3 finalizer), the hashes of integer keys are the identity
+        auto hash = static_cast<uint64_t>(Hash{}(key));
+        hash ^= hash >> 33U;
+        hash *= 0xff51afd7ed558ccdULL;
+        hash ^= hash >> 33U;
+        hash *= 0xc4ceb9fe1a85ec53ULL;
+        hash ^= hash >> 33U;
+        return static_cast<size_t>(hash);
+    }
+
+    // high bits select the shard, low bits the slot within the shard
+    static size_t shardIndexOf(size_t hash) noexcept {
+        return hash >> (std::numeric_limits<size_t>::digits - shardBits);
+    }
+
+    Shard& getShard(size_t hash) noexcept {
+        return shards_[shardIndexOf(hash)];
+    }
+
+    const Shard& getShard(size_t hash) const noexcept {
+        return shards_[shardIndexOf(hash)];
+    }
+
+    static bool isStale([[maybe_unused]] const Item& item) noexcept {
+        if constexpr (IsStaleable<Item>::value) {
+            return item.stale;
+        } else {
+            return false;
+        }
+    }
+
+    [[nodiscard]] static auto acquireLock(const Shard& shard) {
+        return std::scoped_lock(shard.mutex);
+    }
+
+    template <typename K>
+    const Item* findImpl(const K& key) const {
+        const auto hash = hashOf(key);
+        const auto& shard = getShard(hash);
+        auto lock = acquireLock(shard);
+        const auto* item = shard.map.find(key, hash);
+        return item == nullptr || isStale(**item) ? nullptr : item->get();
+    }
+
+    static void onInsert(Shard& shard, size_t count = 1) {
+        if constexpr (IsStaleable<Item>::value) {
+            shard.insertionsSinceSweep += count;
+            if (shard.insertionsSinceSweep >= shard.insertionsUntilSweep) {
+                eraseStale(shard);
+            }
+        }
+    }
+
+    static size_t eraseStale(Shard& shard) {
+        size_t count = 0;
+        if constexpr (IsStaleable<Item>::value) {
+            count = shard.map.eraseIf([](const auto& entry) { return entry.second->stale; });
+        }
+        // sweep cost is proportional to the insertions until the next sweep
+        shard.insertionsSinceSweep = 0;
+        shard.insertionsUntilSweep = std::max(minSweepInterval, shard.map.size());
+        return count;
     }
 
-    std::map<Key, std::unique_ptr<Item>> map_;
-    mutable std::mutex mutex_;
+    std::array<Shard, shardCount> shards_;
 };
 
 }  // namespace opcua::detail
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace opcua::detail {
+
+/**
+ * Recycled storage for completion handler contexts of async requests.
+ * Blocks up to `slotSize` bytes are served from fixed-size slots, which are allocated in chunks
+ * and reused once released. Larger or over-aligned blocks fall back to the heap.
+ * After warm-up, steady-state requests don't allocate.
+ */
+class HandlerSlab {
+public:
+    static constexpr size_t slotSize = 128;
+    static constexpr size_t slotAlignment = alignof(std::max_align_t);
+    static constexpr size_t slotsPerChunk = 64;
+
+    struct Statistics {
+        size_t chunkAllocations;  ///< Number of allocated chunks of slots
+        size_t heapAllocations;  ///< Number of blocks too large for a slot
+        size_t slotsInUse;
+    };
+
+    HandlerSlab() = default;
+    ~HandlerSlab() = default;
+
+    HandlerSlab(const HandlerSlab&) = delete;
+    HandlerSlab(HandlerSlab&&) noexcept = delete;
+    HandlerSlab& operator=(const HandlerSlab&) = delete;
+    HandlerSlab& operator=(HandlerSlab&&) noexcept = delete;
+
+    void* allocate(size_t size, size_t alignment);
+    void deallocate(void* ptr, size_t size, size_t alignment) noexcept;
+
+    Statistics statistics() const;
+
+private:
+    static bool fits(size_t size, size_t alignment) noexcept {
+        return size <= slotSize && alignment <= slotAlignment;
+    }
+
+    union Slot {
+        Slot* next;
+        alignas(slotAlignment) std::byte storage[slotSize];  // NOLINT(*avoid-c-arrays)
+    };
+
+    mutable std::mutex mutex_;
+    Slot* free_{nullptr};
+    std::vector<std::unique_ptr<Slot[]>> chunks_;  // NOLINT(*avoid-c-arrays)
+    size_t heapAllocations_{0};
+    size_t slotsInUse_{0};
+};
+
+}  // namespace opcua::detail
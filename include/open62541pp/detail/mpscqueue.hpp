@@ -0,0 +1,70 @@
+#pragma once
+
+#include <atomic>
+#include <optional>
+#include <utility>  // move
+
+namespace opcua::detail {
+
+/**
+ * Unbounded lock-free multi-producer single-consumer queue.
+ * Intrusive node-based queue by Dmitry Vyukov: producers only exchange the head pointer, so
+ * concurrent pushes never block each other. Only a single thread may pop.
+ * @see https://www.1024cores.net/home/lock-free-algorithms/queues/non-intrusive-mpsc-node-based-queue
+ */
+template <typename T>
+class MpscQueue {
+public:
+    MpscQueue()
+        : head_{new Node},
+          tail_{head_.load(std::memory_order_relaxed)} {}
+
+    ~MpscQueue() {
+        while (pop()) {
+        }
+        delete tail_;  // NOLINT(*owning-memory)
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue(MpscQueue&&) noexcept = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+    MpscQueue& operator=(MpscQueue&&) noexcept = delete;
+
+    /// Push a value, thread-safe.
+    void push(T value) {
+        auto* node = new Node{{nullptr}, std::move(value)};  // NOLINT(*owning-memory)
+        Node* prev = head_.exchange(node, std::memory_order_acq_rel);
+        prev->next.store(node, std::memory_order_release);
+    }
+
+    /// Pop a value, must only be called by the consumer thread.
+    /// Returns `std::nullopt` if the queue is empty (or a concurrent push is not yet completed).
+    std::optional<T> pop() {
+        Node* tail = tail_;
+        Node* next = tail->next.load(std::memory_order_acquire);
+        if (next == nullptr) {
+            return std::nullopt;
+        }
+        std::optional<T> result{std::move(next->value)};
+        next->value.reset();
+        tail_ = next;  // next becomes the new stub node
+        delete tail;  // NOLINT(*owning-memory)
+        return result;
+    }
+
+    /// Check if the queue is empty, must only be called by the consumer thread.
+    bool empty() const noexcept {
+        return tail_->next.load(std::memory_order_acquire) == nullptr;
+    }
+
+private:
+    struct Node {
+        std::atomic<Node*> next{nullptr};
+        std::optional<T> value;
+    };
+
+    std::atomic<Node*> head_;  // last pushed node
+    Node* tail_;  // stub node, its successor is the next value to pop
+};
+
+}  // namespace opcua::detail
@@ -1,8 +1,12 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <cstddef>  // ptrdiff_t
+#include <cstdint>
 #include <functional>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <utility>  // pair
 #include <variant>
@@ -11,7 +15,9 @@
 #include "open62541pp/detail/contextmap.hpp"
 #include "open62541pp/detail/exceptioncatcher.hpp"
 #include "open62541pp/detail/open62541/common.h"  // UA_AccessControl
+#include "open62541pp/detail/open62541/server.h"  // UA_Server
 #include "open62541pp/detail/ptr.hpp"
+#include "open62541pp/detail/threadpool.hpp"
 #include "open62541pp/plugin/nodestore.hpp"
 #include "open62541pp/services/detail/monitoreditem_context.hpp"
 #include "open62541pp/types.hpp"  // NodeId, Variant
@@ -23,9 +29,42 @@ class Session;
 
 namespace opcua::detail {
 
+/// Last result of a data source read, refreshed by worker threads.
+/// Shared with queued refreshes, which might outlive the node.
+/// @see enableDataSourceWorkers, setDataSourceCaching
+struct DataSourceCache {
+    std::mutex mutex;  // guards the cached result
+    DataValue value;
+    StatusCode status;
+    std::chrono::steady_clock::time_point updated;
+    uint64_t generation{0};  // incremented by writes, results of outdated reads are discarded
+    bool hasResult{false};
+    bool refreshing{false};
+
+    std::mutex sourceMutex;  // held by a worker while it reads the data source
+    DataSourceBase* source{nullptr};  // reset if the node or its data source is removed
+
+    /// Discard the cached result and the results of running reads.
+    void invalidate() {
+        const std::scoped_lock lock{mutex};
+        ++generation;
+        hasResult = false;
+    }
+
+    /// Replace the data source, waits until a running read of the previous data source completed.
+    void setSource(DataSourceBase* newSource) {
+        {
+            const std::scoped_lock lock{sourceMutex};
+            source = newSource;
+        }
+        invalidate();
+    }
+};
+
 struct NodeContext {
     UniqueOrRawPtr<ValueCallbackBase> valueCallback;
     UniqueOrRawPtr<DataSourceBase> dataSource;
+    std::shared_ptr<DataSourceCache> dataSourceCache;  // only set if caching is enabled
 
 #ifdef UA_ENABLE_METHODCALLS
     using MethodCallback = std::variant<
@@ -42,6 +81,40 @@ struct NodeContext {
 #endif
 };
 
+/// Hash function for NodeId and UA_NodeId keys, allows lookups by UA_NodeId without copies.
+struct NodeIdHash {
+    size_t operator()(const UA_NodeId& id) const noexcept {
+        return UA_NodeId_hash(&id);
+    }
+};
+
+struct DataSourceWorkers {
+    ThreadPool pool;
+    std::chrono::steady_clock::duration maxAge;
+};
+
+#if UAPP_HAS_ASYNC_OPERATIONS
+struct AsyncOperationWorkers {
+    struct MethodStatistics {
+        size_t count{0};
+        std::chrono::steady_clock::duration totalDuration{};
+        std::chrono::steady_clock::duration maxDuration{};
+    };
+
+    explicit AsyncOperationWorkers(size_t threads)
+        : pool{threads, 2 * threads} {}
+
+    void (*notifyCallback)(UA_Server*){nullptr};  // previous callback of the server config
+    // queue depth: incremented by the notify callback, decremented by dequeuing workers and
+    // reset once the queue is drained (signed, an operation might be dequeued before notified)
+    std::atomic<ptrdiff_t> queued{0};
+    std::atomic<size_t> running{0};
+    std::mutex mutexStatistics;
+    std::map<NodeId, MethodStatistics> methods;  // guarded by mutexStatistics
+    ThreadPool pool;  // destroyed first
+};
+#endif
+
 struct SessionRegistry {
     using Context = void*;
 
@@ -57,13 +130,18 @@ struct SessionRegistry {
 struct ServerContext {
     ExceptionCatcher exceptionCatcher;
     SessionRegistry sessionRegistry;
+    decltype(UA_GlobalNodeLifecycle::destructor) nodeDestructorUser{nullptr};
     std::atomic<bool> running{false};
     std::mutex mutexRun;
     std::mutex mutexStartup;
     bool stopRequested{false};  // guarded by mutexStartup
 
     ContextMap<uint64_t, Staleable<std::function<void()>>> callbacks;
-    ContextMap<NodeId, NodeContext> nodeContexts;
+    ContextMap<NodeId, NodeContext, NodeIdHash> nodeContexts;
+    std::unique_ptr<DataSourceWorkers> dataSourceWorkers;  // destroyed before node contexts
+#if UAPP_HAS_ASYNC_OPERATIONS
+    std::unique_ptr<AsyncOperationWorkers> asyncOperationWorkers;
+#endif
 
 #ifdef UA_ENABLE_SUBSCRIPTIONS
     using SubId = IntegerId;  // always 0
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace opcua::detail {
+
+/**
+ * Fixed-size pool of worker threads with a bounded task queue.
+ * Submissions are rejected if the queue is full (back-pressure).
+ * Queued tasks are still executed when the pool is destroyed.
+ */
+class ThreadPool {
+public:
+    using Task = std::function<void()>;
+
+    ThreadPool(size_t threads, size_t maxQueueSize);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool(ThreadPool&&) noexcept = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ThreadPool& operator=(ThreadPool&&) noexcept = delete;
+
+    /// Queue a task, return `false` if the queue is full.
+    /// Exceptions thrown by the task are ignored.
+    bool trySubmit(Task&& task);
+
+    /// Number of queued tasks, not yet picked up by a worker.
+    size_t queueSize() const;
+
+    size_t threadCount() const noexcept {
+        return threads_.size();
+    }
+
+private:
+    void work();
+
+    const size_t maxQueueSize_;
+    std::deque<Task> queue_;
+    bool stopped_{false};
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<std::thread> threads_;
+};
+
+}  // namespace opcua::detail
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <optional>
@@ -186,8 +187,19 @@ public:
     [[deprecated("use free function setVariableNodeValueBackend instead")]]
     void setVariableNodeDataSource(const NodeId& id, std::unique_ptr<DataSourceBase>&& source);
 
-    /// Run a single iteration of the server's main loop.
-    /// @return Maximum wait period until next Server::runIterate call (in ms)
+    /**
+     * Run a single iteration of the server's main loop without waiting for network messages.
+     *
+     * Use this method to drive the server from an external event loop (e.g. epoll/io_uring):
+     * Arm a timer with the returned wait period and call runIterate again when the timer expires.
+     * The server starts on the first call.
+     *
+     * @note open62541 does not expose its sockets in the public API, so the sockets can not be
+     *       registered with an external reactor. Incoming messages are processed with the next
+     *       call of runIterate, hence the wait period is the maximum latency of a request.
+     *       Limit the wait period (e.g. to 10 ms) if lower latencies are required.
+     * @return Maximum wait period until next Server::runIterate call (in ms)
+     */
     uint16_t runIterate();
     /// Run the server's main loop. This method will block until Server::stop is called.
     void run();
@@ -250,6 +262,56 @@ void setVariableNodeValueBackend(
     Server& server, const NodeId& id, std::unique_ptr<DataSourceBase>&& source
 );
 
+/**
+ * Enable or disable the cache of the data source workers for a variable node.
+ *
+ * Cached values are shared by all sessions. Only enable caching for data sources that return the
+ * same value for every session, i.e. without evaluating access rights or per-user values of the
+ * session in @ref DataSourceBase::read. Reads of nodes without caching always invoke the data
+ * source synchronously.
+ * @see enableDataSourceWorkers
+ * @relates Server
+ */
+void setDataSourceCaching(Server& server, const NodeId& id, bool enabled = true);
+
+/// Options for @ref enableDataSourceWorkers.
+struct DataSourceWorkerOptions {
+    /// Number of worker threads, `0` to use the number of hardware threads.
+    size_t threads{0};
+    /// Maximum number of queued data source reads. Refreshes are skipped if the queue is full.
+    size_t maxQueueSize{10000};
+    /// Maximum age of a cached value before a refresh is scheduled.
+    std::chrono::milliseconds maxAge{100};
+};
+
+/**
+ * Dispatch data source reads to a pool of worker threads.
+ *
+ * By default, @ref DataSourceBase::read is invoked synchronously within the server loop, so a
+ * slow data source blocks all sessions. With workers enabled, reads of nodes with caching enabled
+ * (see @ref setDataSourceCaching) are served from a per-node cache that is refreshed by the worker
+ * threads (stale-while-revalidate):
+ * - If no value is cached yet (or the cached value was invalidated by a write), the data source is
+ *   read synchronously.
+ * - If the cached value is older than `maxAge`, a refresh is queued and the stale value is
+ *   returned.
+ * - If the queue is full, no refresh is queued (back-pressure) and the stale value is returned.
+ *
+ * Reads of other nodes, reads of an index range and writes are still invoked synchronously;
+ * writes invalidate the cached value.
+ * Refreshes are invoked with the session of the read that triggered them, looked up when the
+ * refresh runs. Closed sessions are passed without session context.
+ *
+ * @warning Data sources are accessed concurrently by the worker threads and must be thread-safe.
+ * @relates Server
+ */
+void enableDataSourceWorkers(Server& server, const DataSourceWorkerOptions& options = {});
+
+/// Stop the data source workers and read data sources synchronously again.
+/// Queued reads are completed before this function returns.
+/// @relates Server
+void disableDataSourceWorkers(Server& server);
+
 /* -------------------------------------- Async operations -------------------------------------- */
 
 #if UAPP_HAS_ASYNC_OPERATIONS
@@ -275,6 +337,49 @@ std::optional<AsyncOperation> getAsyncOperation(Server& server) noexcept;
 /// Run the provided async operation.
 /// @relates Server
 void runAsyncOperation(Server& server, const AsyncOperation& operation);
+
+/**
+ * Process async operations in a pool of worker threads owned by the server.
+ *
+ * Replaces hand-written worker loops of @ref getAsyncOperation and @ref runAsyncOperation.
+ * The workers are woken up by the server whenever an operation is queued, so long-running
+ * methods (see @ref useAsyncOperation) don't stall the server loop and are executed in parallel.
+ * Calling this function again replaces the current workers, queued operations are completed
+ * first.
+ *
+ * @param server Server instance
+ * @param threads Number of worker threads, `0` to use the number of hardware threads
+ * @warning Method callbacks are executed concurrently by the worker threads.
+ * @relates Server
+ */
+void enableAsyncOperationWorkers(Server& server, size_t threads = 0);
+
+/// Stop the async operation workers, queued operations are completed first.
+/// @relates Server
+void disableAsyncOperationWorkers(Server& server);
+
+/// Execution statistics of a method, see @ref getAsyncOperationStatistics.
+struct AsyncOperationMethodStatistics {
+    NodeId methodId;
+    size_t count;  ///< Number of completed calls
+    std::chrono::nanoseconds totalDuration;  ///< Total execution time of all calls
+    std::chrono::nanoseconds maxDuration;  ///< Longest execution time of a single call
+};
+
+/// Statistics of the async operation workers, see @ref getAsyncOperationStatistics.
+struct AsyncOperationStatistics {
+    /// Number of operations waiting for a worker (queue depth).
+    /// Approximate: operations removed from the queue by timeouts are counted until the queue is
+    /// drained by a worker, operations queued before the workers were enabled are not counted.
+    size_t queued;
+    size_t running;  ///< Number of operations currently executed by a worker
+    std::vector<AsyncOperationMethodStatistics> methods;  ///< Per-method execution times
+};
+
+/// Get the statistics of the async operation workers.
+/// All values are zero if the workers are not enabled.
+/// @relates Server
+AsyncOperationStatistics getAsyncOperationStatistics(Server& server);
 #endif
 
 }  // namespace opcua
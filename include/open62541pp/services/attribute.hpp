@@ -1,9 +1,16 @@
 #pragma once
 
+#include <cstddef>
+#include <functional>
+#include <memory>  // make_shared
+#include <type_traits>  // is_same_v
 #include <utility>
+#include <vector>
 
 #include "open62541pp/async.hpp"
 #include "open62541pp/detail/open62541/common.h"
+#include "open62541pp/detail/result_utils.hpp"  // tryInvoke
+#include "open62541pp/exception.hpp"
 #include "open62541pp/result.hpp"
 #include "open62541pp/services/detail/async_transform.hpp"
 #include "open62541pp/services/detail/attribute_handler.hpp"
@@ -317,4 +324,149 @@ auto writeDataValueAsync(
  * @}
  */
 
+/* ------------------------------------- Batched functions -------------------------------------- */
+
+namespace detail {
+
+/// Get an operation limit from the result of reading its variable, 0 if unknown (no limit).
+uint32_t getOperationLimit(const Result<DataValue>& result) noexcept;
+
+/// Handler for the response of a chunk of nodes `[offset, offset + count)`.
+using ReadChunkHandler = std::function<void(size_t offset, size_t count, ReadResponse& response)>;
+
+/// Read the value attribute of nodes with requests limited to the server's MaxNodesPerRead.
+/// The chunks are sent in parallel, the function returns if all responses are handled.
+void readValuesChunked(Client& connection, Span<const NodeId> ids, const ReadChunkHandler& handler);
+
+using WriteValuesHandler = std::function<void(std::vector<StatusCode>& results)>;
+
+/// Send the write request in chunks limited to the server's MaxNodesPerWrite.
+/// The handler is invoked once all responses are handled.
+/// The request is only copied if the operation limit is not cached yet.
+void writeValuesChunkedAsync(
+    Client& connection, const WriteRequest& request, WriteValuesHandler handler
+);
+
+template <typename T>
+Result<T> convertValue(Variant&& var) noexcept {
+    if constexpr (std::is_same_v<T, Variant>) {
+        return std::move(var);
+    } else {
+        return opcua::detail::tryInvoke([&] { return std::move(var).to<T>(); });
+    }
+}
+
+}  // namespace detail
+
+/**
+ * Read the AttributeId::Value attribute of multiple nodes (client only).
+ *
+ * All nodes are read with a single ReadRequest. If the number of nodes exceeds the server's
+ * `MaxNodesPerRead` operation limit, the request is split into chunks which are sent in parallel.
+ * The operation limit is read once per session and cached.
+ * The values are moved out of the response and converted to type `T`.
+ *
+ * @param connection Instance of type Client
+ * @param ids Nodes to read
+ * @param results Output vector, reused to store the result of each node
+ * @ingroup Read
+ */
+template <typename T>
+void readValuesAs(Client& connection, Span<const NodeId> ids, std::vector<Result<T>>& results) {
+    results.clear();
+    results.resize(ids.size(), BadResult{UA_STATUSCODE_BADUNEXPECTEDERROR});
+    detail::readValuesChunked(
+        connection,
+        ids,
+        [&results](size_t offset, size_t count, ReadResponse& response) {
+            auto& native = asNative(response);
+            const StatusCode serviceResult = native.responseHeader.serviceResult;
+            for (size_t i = 0; i < count; ++i) {
+                auto& result = results[offset + i];
+                if (serviceResult.isBad()) {
+                    result = BadResult{serviceResult};
+                } else if (i < native.resultsSize) {
+                    auto& dv = asWrapper<DataValue>(native.results[i]);  // NOLINT
+                    result = detail::getVariant(std::move(dv)).andThen(detail::convertValue<T>);
+                }
+            }
+        }
+    );
+}
+
+/**
+ * @copydoc readValuesAs(Client&, Span<const NodeId>, std::vector<Result<T>>&)
+ * @return Result of each node
+ */
+template <typename T>
+std::vector<Result<T>> readValuesAs(Client& connection, Span<const NodeId> ids) {
+    std::vector<Result<T>> results;
+    readValuesAs(connection, ids, results);
+    return results;
+}
+
+/**
+ * @copydoc readValuesAs(Client&, Span<const NodeId>, std::vector<Result<T>>&)
+ * @return Value of each node
+ */
+inline std::vector<Result<Variant>> readValues(Client& connection, Span<const NodeId> ids) {
+    return readValuesAs<Variant>(connection, ids);
+}
+
+/**
+ * Write the AttributeId::Value attribute of multiple nodes (client only).
+ *
+ * All nodes are written with a single WriteRequest. If the number of nodes exceeds the server's
+ * `MaxNodesPerWrite` operation limit, the request is split into chunks which are sent in parallel.
+ * The operation limit is read once per session and cached.
+ *
+ * @param connection Instance of type Client
+ * @param ids Nodes to write
+ * @param values Values to write, one for each node
+ * @return Status code of each node
+ * @exception BadStatus (BadInvalidArgument) If the number of nodes and values differ
+ * @ingroup Write
+ */
+std::vector<StatusCode> writeValues(
+    Client& connection, Span<const NodeId> ids, Span<const Variant> values
+);
+
+/**
+ * @copydoc writeValues
+ * @param token @completiontoken{void(std::vector<StatusCode>&)}
+ * @return @asyncresult{std::vector<StatusCode>}
+ */
+template <typename CompletionToken>
+auto writeValuesAsync(
+    Client& connection,
+    Span<const NodeId> ids,
+    Span<const Variant> values,
+    CompletionToken&& token
+) {
+    if (ids.size() != values.size()) {
+        throw BadStatus{UA_STATUSCODE_BADINVALIDARGUMENT};
+    }
+    const auto items = detail::makeWriteValues(ids, values);
+    const auto request = detail::makeWriteRequest(
+        Span<const UA_WriteValue>{items.data(), items.size()}
+    );
+    return asyncInitiate<std::vector<StatusCode>>(
+        [&connection](auto&& handler, const WriteRequest& innerRequest) {
+            // std::function requires copyable handlers
+            auto sharedHandler = std::make_shared<std::decay_t<decltype(handler)>>(
+                std::forward<decltype(handler)>(handler)
+            );
+            detail::writeValuesChunkedAsync(
+                connection,
+                innerRequest,
+                [sharedHandler](std::vector<StatusCode>& results) {
+                    std::invoke(*sharedHandler, results);
+                }
+            );
+        },
+        std::forward<CompletionToken>(token),
+        asWrapper<WriteRequest>(request)
+    );
+}
+
 }  // namespace opcua::services
@@ -3,12 +3,14 @@
 #include <cassert>
 #include <functional>  // invoke
 #include <memory>
+#include <new>  // placement new
 #include <type_traits>
 #include <utility>  // forward
 
 #include "open62541pp/async.hpp"
 #include "open62541pp/detail/client_utils.hpp"
 #include "open62541pp/detail/exceptioncatcher.hpp"
+#include "open62541pp/detail/handlerslab.hpp"
 #include "open62541pp/detail/open62541/client.h"
 #include "open62541pp/exception.hpp"
 #include "open62541pp/typeregistry.hpp"  // getDataType
@@ -21,28 +23,47 @@ namespace opcua::services::detail {
 template <typename Response>
 struct AsyncServiceAdapter {
     using ExceptionCatcher = opcua::detail::ExceptionCatcher;
+    using HandlerSlab = opcua::detail::HandlerSlab;
+
+    /// Destroy the context and return its storage to the slab (or heap if no slab is used).
+    template <typename Context>
+    struct ContextDeleter {
+        void operator()(Context* context) const noexcept {
+            HandlerSlab* slab = context->slab;
+            context->~Context();
+            if (slab != nullptr) {
+                slab->deallocate(context, sizeof(Context), alignof(Context));
+            } else {
+                ::operator delete(context);
+            }
+        }
+    };
+
+    template <typename Context>
+    using ContextPtr = std::unique_ptr<Context, ContextDeleter<Context>>;
 
     template <typename Context>
     struct CallbackAndContext {
         UA_ClientAsyncServiceCallback callback;
-        std::unique_ptr<Context> context;
+        ContextPtr<Context> context;
     };
 
     template <typename CompletionHandler>
     static auto makeCallbackAndContext(
-        ExceptionCatcher& exceptionCatcher, CompletionHandler&& handler
+        ExceptionCatcher& exceptionCatcher, HandlerSlab* slab, CompletionHandler&& handler
     ) {
         static_assert(std::is_invocable_v<CompletionHandler, Response&>);
 
         struct Context {
             ExceptionCatcher* catcher;
+            HandlerSlab* slab;
             std::decay_t<CompletionHandler> handler;
         };
 
         const auto callback =
             [](UA_Client*, void* userdata, uint32_t /* reqId */, void* responsePtr) {
-                std::unique_ptr<Context> context{static_cast<Context*>(userdata)};
-                assert(context != nullptr);
+                assert(userdata != nullptr);
+                ContextPtr<Context> context{static_cast<Context*>(userdata)};
                 assert(context->catcher != nullptr);
                 context->catcher->invoke([context = context.get(), responsePtr] {
                     if (responsePtr == nullptr) {
@@ -52,12 +73,33 @@ struct AsyncServiceAdapter {
                 });
             };
 
-        return CallbackAndContext<Context>{
-            callback,
-            std::make_unique<Context>(
-                Context{&exceptionCatcher, std::forward<CompletionHandler>(handler)}
-            )
-        };
+        void* storage = slab != nullptr
+            ? slab->allocate(sizeof(Context), alignof(Context))
+            : ::operator new(sizeof(Context));
+        try {
+            return CallbackAndContext<Context>{
+                callback,
+                ContextPtr<Context>{new (storage) Context{
+                    &exceptionCatcher, slab, std::forward<CompletionHandler>(handler)
+                }}
+            };
+        } catch (...) {
+            if (slab != nullptr) {
+                slab->deallocate(storage, sizeof(Context), alignof(Context));
+            } else {
+                ::operator delete(storage);
+            }
+            throw;
+        }
+    }
+
+    template <typename CompletionHandler>
+    static auto makeCallbackAndContext(
+        ExceptionCatcher& exceptionCatcher, CompletionHandler&& handler
+    ) {
+        return makeCallbackAndContext(
+            exceptionCatcher, nullptr, std::forward<CompletionHandler>(handler)
+        );
     }
 
     /**
@@ -86,7 +128,9 @@ struct AsyncServiceAdapter {
                 try {
                     // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks), false positive?
                     auto callbackAndContext = makeCallbackAndContext(
-                        catcher, std::forward<decltype(handler)>(handler)
+                        catcher,
+                        &opcua::detail::getHandlerSlab(client),
+                        std::forward<decltype(handler)>(handler)
                     );
                     std::invoke(
                         std::forward<decltype(innerInitiation)>(innerInitiation),
@@ -108,6 +152,19 @@ struct AsyncServiceAdapter {
     }
 };
 
+/// Buffer the request for coalescing if enabled and supported (see Client::setRequestCoalescing).
+/// @return `true` if the request was buffered, `false` if it has to be sent
+bool coalesceRequest(
+    Client& client,
+    const UA_DataType& requestType,
+    const void* request,
+    UA_ClientAsyncServiceCallback callback,
+    void* userdata
+);
+
+/// Send the buffered requests of the coalescer, must be called before requests that bypass it.
+void flushCoalescedRequests(Client& client) noexcept;
+
 /// Async client service requests.
 template <typename Request, typename Response, typename CompletionToken>
 auto sendRequestAsync(Client& client, const Request& request, CompletionToken&& token) {
@@ -116,6 +173,10 @@ auto sendRequestAsync(Client& client, const Request& request, CompletionToken&&
         [&client](
             UA_ClientAsyncServiceCallback callback, void* userdata, const Request& innerRequest
         ) {
+            const auto& type = getDataType<Request>();
+            if (coalesceRequest(client, type, &innerRequest, callback, userdata)) {
+                return;
+            }
             throwIfBad(__UA_Client_AsyncService(
                 opcua::detail::getHandle(client),
                 &innerRequest,
@@ -131,9 +192,37 @@ auto sendRequestAsync(Client& client, const Request& request, CompletionToken&&
     );
 }
 
+/// Async client service request with a callback handler, bypassing the coalescer.
+/// In contrast to sendRequestAsync, a failed send is reported to the caller and not stored in the
+/// exception catcher. The handler is only invoked if the request was sent.
+/// @return Status code of sending the request
+template <typename Request, typename Response, typename Handler>
+UA_StatusCode trySendRequestAsync(Client& client, const Request& request, Handler&& handler) {
+    auto callbackAndContext = AsyncServiceAdapter<Response>::makeCallbackAndContext(
+        opcua::detail::getExceptionCatcher(client),
+        &opcua::detail::getHandlerSlab(client),
+        std::forward<Handler>(handler)
+    );
+    flushCoalescedRequests(client);
+    const UA_StatusCode status = __UA_Client_AsyncService(
+        opcua::detail::getHandle(client),
+        &request,
+        &getDataType<Request>(),
+        callbackAndContext.callback,
+        &getDataType<Response>(),
+        callbackAndContext.context.get(),
+        nullptr
+    );
+    if (status == UA_STATUSCODE_GOOD) {
+        callbackAndContext.context.release();  // owned by the callback
+    }
+    return status;
+}
+
 /// Sync client service requests.
 template <typename Request, typename Response>
 Response sendRequest(Client& client, const Request& request) noexcept {
+    flushCoalescedRequests(client);  // keep the issue order of buffered async requests
     Response response{};
     __UA_Client_Service(
         opcua::detail::getHandle(client),
@@ -2,10 +2,15 @@
 
 #include <cstdint>
 #include <functional>
+#include <memory>
 
+#include "open62541pp/common.hpp"  // AttributeId
+#include "open62541pp/config.hpp"
 #include "open62541pp/services/detail/callbackadapter.hpp"
+#include "open62541pp/services/detail/subscription_context.hpp"
 #include "open62541pp/span.hpp"
-#include "open62541pp/ua/types.hpp"  // DataValue, IntegerId, Variant
+#include "open62541pp/types.hpp"  // DataValue, NodeId, Variant
+#include "open62541pp/ua/types.hpp"  // IntegerId
 #include "open62541pp/wrapper.hpp"  // asWrapper
 
 struct UA_Client;
@@ -13,13 +18,20 @@ struct UA_Server;
 
 namespace opcua::services::detail {
 
-struct MonitoredItemContext : CallbackAdapter {
-    bool stale{false};
-    bool inserted{false};
-    ReadValueId itemToMonitor;
+/// Callbacks of all items created with a single call.
+/// Shared by the item contexts, so callbacks are not copied for each item.
+struct MonitoredItemCallbacks : CallbackAdapter {
     std::function<void(IntegerId subId, IntegerId monId, const DataValue&)> dataChangeCallback;
     std::function<void(IntegerId subId, IntegerId monId, Span<const Variant>)> eventCallback;
     std::function<void(IntegerId subId, IntegerId monId)> deleteCallback;
+};
+
+struct MonitoredItemContext {
+    bool stale{false};
+    bool inserted{false};
+    AttributeId attributeId{};
+    NodeId nodeId;  ///< Monitored node, freed with the item (the index range etc. is not kept)
+    std::shared_ptr<const MonitoredItemCallbacks> callbacks;
 
     static void dataChangeCallbackNativeServer(
         [[maybe_unused]] UA_Server* server,
@@ -35,7 +47,10 @@ struct MonitoredItemContext : CallbackAdapter {
             if (!self->inserted) {
                 return;  // avoid immediate callbacks before insertion
             }
-            self->invoke(self->dataChangeCallback, 0U, monId, asWrapper<DataValue>(*value));
+            const auto& callbacks = *self->callbacks;
+            callbacks.invoke(
+                callbacks.dataChangeCallback, 0U, monId, asWrapper<DataValue>(*value)
+            );
         }
     }
 
@@ -52,7 +67,17 @@ struct MonitoredItemContext : CallbackAdapter {
             if (!self->inserted) {
                 return;  // avoid immediate callbacks before insertion
             }
-            self->invoke(self->dataChangeCallback, subId, monId, asWrapper<DataValue>(*value));
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+            auto* subscription = static_cast<SubscriptionContext*>(subContext);
+            if (subscription != nullptr && subscription->dataChangeBatchCallback != nullptr) {
+                subscription->pushDataChange(subId, monId, *value);
+                return;
+            }
+#endif
+            const auto& callbacks = *self->callbacks;
+            callbacks.invoke(
+                callbacks.dataChangeCallback, subId, monId, asWrapper<DataValue>(*value)
+            );
         }
     }
 
@@ -70,8 +95,9 @@ struct MonitoredItemContext : CallbackAdapter {
             if (!self->inserted) {
                 return;  // avoid immediate callbacks before insertion
             }
-            self->invoke(
-                self->eventCallback,
+            const auto& callbacks = *self->callbacks;
+            callbacks.invoke(
+                callbacks.eventCallback,
                 subId,
                 monId,
                 Span<const Variant>{asWrapper<Variant>(eventFields), nEventFields}
@@ -88,7 +114,8 @@ struct MonitoredItemContext : CallbackAdapter {
     ) noexcept {
         if (monContext != nullptr) {
             auto* self = static_cast<MonitoredItemContext*>(monContext);
-            self->invoke(self->deleteCallback, subId, monId);
+            const auto& callbacks = *self->callbacks;
+            callbacks.invoke(callbacks.deleteCallback, subId, monId);
             self->stale = true;
         }
     }
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include "open62541pp/detail/open62541/client.h"  // UA_ClientAsyncServiceCallback
+
+namespace opcua::services::detail {
+
+/**
+ * Buffer single-item async Read, Write and Call requests and merge them into one request per
+ * service. The merged response is split and fanned out to the callbacks of the original requests.
+ * @see Client::setRequestCoalescing
+ */
+class RequestCoalescer {
+public:
+    RequestCoalescer();
+    ~RequestCoalescer();  // cancel buffered requests
+
+    RequestCoalescer(const RequestCoalescer&) = delete;
+    RequestCoalescer(RequestCoalescer&&) noexcept = delete;
+    RequestCoalescer& operator=(const RequestCoalescer&) = delete;
+    RequestCoalescer& operator=(RequestCoalescer&&) noexcept = delete;
+
+    bool isEnabled() const noexcept {
+        return enabled_;
+    }
+
+    void setEnabled(bool enabled, size_t maxItems) noexcept {
+        enabled_ = enabled;
+        maxItems_ = maxItems;
+    }
+
+    /// Buffer the request if it can be coalesced.
+    /// Buffered requests of other services are sent first to keep the issue order. If the request
+    /// can not be coalesced, all buffered requests are sent before it.
+    /// @param limit Operation limit of the server for the service (0 = unknown or no limit)
+    /// @return `true` if the request was buffered, `false` if it has to be sent as usual
+    bool push(
+        UA_Client* client,
+        const UA_DataType& requestType,
+        const void* request,
+        UA_ClientAsyncServiceCallback callback,
+        void* userdata,
+        size_t limit = 0
+    );
+
+    /// Send all buffered requests.
+    void flush(UA_Client* client) noexcept;
+
+    /// Invoke the callbacks of all buffered requests with a bad service result.
+    void cancel(UA_Client* client, UA_StatusCode code) noexcept;
+
+private:
+    struct Batches;
+
+    bool enabled_{false};
+    size_t maxItems_{0};
+    const UA_DataType* bufferedType_{nullptr};  // request type of the buffered requests
+    std::unique_ptr<Batches> batches_;
+};
+
+}  // namespace opcua::services::detail
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>  // transform
+#include <cassert>
 #include <type_traits>  // remove_const_t
 #include <vector>
 
@@ -143,6 +144,16 @@ inline UA_ReadRequest makeReadRequest(
     return request;
 }
 
+inline UA_ReadRequest makeReadRequest(
+    TimestampsToReturn timestamps, Span<const UA_ReadValueId> items
+) noexcept {
+    UA_ReadRequest request{};
+    request.timestampsToReturn = static_cast<UA_TimestampsToReturn>(timestamps);
+    request.nodesToReadSize = items.size();
+    request.nodesToRead = getPointer(items);
+    return request;
+}
+
 inline UA_ReadRequest makeReadRequest(
     TimestampsToReturn timestamps, Span<const ReadValueId> nodesToRead
 ) noexcept {
@@ -178,6 +189,27 @@ inline UA_WriteRequest makeWriteRequest(Span<const WriteValue> nodesToWrite) noe
     return request;
 }
 
+inline UA_WriteRequest makeWriteRequest(Span<const UA_WriteValue> nodesToWrite) noexcept {
+    UA_WriteRequest request{};
+    request.nodesToWriteSize = nodesToWrite.size();
+    request.nodesToWrite = getPointer(nodesToWrite);
+    return request;
+}
+
+inline std::vector<UA_WriteValue> makeWriteValues(
+    Span<const NodeId> ids, Span<const Variant> values
+) {
+    assert(ids.size() == values.size());
+    std::vector<UA_WriteValue> items(ids.size());
+    for (size_t i = 0; i < items.size(); ++i) {
+        items[i].nodeId = ids[i];
+        items[i].attributeId = UA_ATTRIBUTEID_VALUE;
+        items[i].value.value = values[i];  // shallow copy, avoid copy of value
+        items[i].value.hasValue = true;
+    }
+    return items;
+}
+
 #ifdef UA_ENABLE_METHODCALLS
 
 inline UA_CallMethodRequest makeCallMethodRequest(
@@ -229,17 +261,34 @@ inline UA_TranslateBrowsePathsToNodeIdsRequest makeTranslateBrowsePathsToNodeIds
     return request;
 }
 
-inline BrowsePath makeBrowsePath(const NodeId& origin, Span<const QualifiedName> browsePath) {
-    std::vector<RelativePathElement> relativePathElements(browsePath.size());
+inline std::vector<UA_RelativePathElement> makeRelativePathElements(
+    Span<const QualifiedName> browsePath
+) {
+    std::vector<UA_RelativePathElement> elements(browsePath.size());
     std::transform(
         browsePath.begin(),
         browsePath.end(),
-        relativePathElements.begin(),
-        [](const auto& qn) {
-            return RelativePathElement(ReferenceTypeId::HierarchicalReferences, false, true, qn);
+        elements.begin(),
+        [](const QualifiedName& qn) {
+            UA_RelativePathElement item{};
+            item.referenceTypeId = UA_NODEID_NUMERIC(0, UA_NS0ID_HIERARCHICALREFERENCES);
+            item.isInverse = false;
+            item.includeSubtypes = true;
+            item.targetName = qn;  // shallow copy, no allocation
+            return item;
         }
     );
-    return {origin, RelativePath(relativePathElements)};
+    return elements;
+}
+
+inline UA_BrowsePath makeBrowsePath(
+    const NodeId& origin, Span<const UA_RelativePathElement> relativePathElements
+) noexcept {
+    UA_BrowsePath browsePath{};
+    browsePath.startingNode = origin;
+    browsePath.relativePath.elementsSize = relativePathElements.size();
+    browsePath.relativePath.elements = getPointer(relativePathElements);
+    return browsePath;
 }
 
 #ifdef UA_ENABLE_SUBSCRIPTIONS
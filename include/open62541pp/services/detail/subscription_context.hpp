@@ -1,9 +1,15 @@
 #pragma once
 
+#include <algorithm>  // remove
+#include <exception>  // current_exception
 #include <functional>
+#include <utility>  // pair, swap
+#include <vector>
 
 #include "open62541pp/config.hpp"
 #include "open62541pp/services/detail/callbackadapter.hpp"
+#include "open62541pp/span.hpp"
+#include "open62541pp/types.hpp"  // DataValue
 #include "open62541pp/ua/types.hpp"  // IntegerId, StatusChangeNotification
 #include "open62541pp/wrapper.hpp"  // asWrapper
 
@@ -14,10 +20,61 @@ struct UA_Client;
 namespace opcua::services::detail {
 
 struct SubscriptionContext : CallbackAdapter {
+    using DataChange = std::pair<IntegerId, DataValue>;
+
     bool stale{false};
     std::function<void(IntegerId subId, StatusChangeNotification&)> statusChangeCallback;
     std::function<void(IntegerId subId)> deleteCallback;
 
+    // Data changes are collected and delivered in batches if a batch callback is set.
+    // Subscriptions with collected data changes are listed in `pendingBatches` (owned by the client
+    // context), which is flushed after each client iteration.
+    std::function<void(IntegerId subId, Span<DataChange>)> dataChangeBatchCallback;
+    std::vector<DataChange> dataChanges;
+    std::vector<SubscriptionContext*>* pendingBatches = nullptr;
+    IntegerId subscriptionId{0U};
+
+    /// Move value into the current batch, the native value is left empty.
+    void pushDataChange(IntegerId subId, IntegerId monId, UA_DataValue& value) noexcept {
+        try {
+            if (dataChanges.empty()) {
+                pendingBatches->push_back(this);
+            }
+            subscriptionId = subId;
+            dataChanges.emplace_back(monId, DataValue{});
+            std::swap(*dataChanges.back().second.handle(), value);
+        } catch (...) {
+            if (catcher != nullptr) {
+                catcher->setException(std::current_exception());
+            }
+        }
+    }
+
+    /// Deliver the current batch.
+    void flushDataChanges() noexcept {
+        if (dataChanges.empty()) {
+            return;
+        }
+        // callbacks might collect new data changes, e.g. within synchronous service calls
+        std::vector<DataChange> batch;
+        batch.swap(dataChanges);
+        invoke(dataChangeBatchCallback, subscriptionId, Span<DataChange>{batch});
+        batch.clear();
+        if (dataChanges.empty()) {
+            dataChanges.swap(batch);  // reuse capacity
+        }
+    }
+
+    /// Deliver the current batch outside of the client iteration and remove it from the pending
+    /// batches, e.g. before the batch callback is replaced or the subscription is deleted.
+    void flushDataChangesNow() noexcept {
+        if (pendingBatches != nullptr) {
+            auto& pending = *pendingBatches;
+            pending.erase(std::remove(pending.begin(), pending.end(), this), pending.end());
+        }
+        flushDataChanges();
+    }
+
     static void statusChangeCallbackNative(
         [[maybe_unused]] UA_Client* client,
         IntegerId subId,
@@ -39,6 +96,7 @@ struct SubscriptionContext : CallbackAdapter {
     ) noexcept {
         if (subContext != nullptr) {
             auto* self = static_cast<SubscriptionContext*>(subContext);
+            self->flushDataChangesNow();
             self->invoke(self->deleteCallback, subId);
             self->stale = true;
         }
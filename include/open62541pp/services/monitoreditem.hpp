@@ -183,6 +183,7 @@ auto createMonitoredItemsDataChangeAsync(
             Span<const UA_Client_DataChangeNotificationCallback> innerDataChangeCallbacks,
             Span<const UA_Client_DeleteMonitoredItemCallback> innerDeleteCallbacks
         ) {
+            detail::flushCoalescedRequests(connection);
             throwIfBad(UA_Client_MonitoredItems_createDataChanges_async(
                 opcua::detail::getHandle(connection),
                 asNative(innerRequest),
@@ -214,6 +215,31 @@ auto createMonitoredItemsDataChangeAsync(
 }
 #endif
 
+/**
+ * Create and add monitored items to a subscription for data change notifications.
+ * The items are sent with a single CreateMonitoredItems request, split into chunks by the
+ * `MaxMonitoredItemsPerCall` operation limit of the server. Multiple chunks are sent in parallel
+ * and the client is iterated until all responses are handled.
+ *
+ * @param connection Instance of type Client
+ * @param subscriptionId Identifier of the subscription returned by @ref createSubscription
+ * @param itemsToMonitor Items to monitor
+ * @param monitoringMode Monitoring mode of all items
+ * @param parameters Monitoring parameters of all items
+ * @param dataChangeCallback Invoked when a monitored item is changed
+ * @param deleteCallback Invoked when a monitored item is deleted
+ * @return Create results in the order of `itemsToMonitor`
+ */
+[[nodiscard]] std::vector<MonitoredItemCreateResult> createMonitoredItemsDataChange(
+    Client& connection,
+    IntegerId subscriptionId,
+    Span<const ReadValueId> itemsToMonitor,
+    MonitoringMode monitoringMode,
+    const MonitoringParametersEx& parameters,
+    DataChangeNotificationCallback dataChangeCallback,
+    DeleteMonitoredItemCallback deleteCallback
+);
+
 /**
  * Create and add a monitored item to a subscription for data change notifications.
  * Don't use this function to monitor the `EventNotifier` attribute.
@@ -327,6 +353,7 @@ auto createMonitoredItemsEventAsync(
             Span<const UA_Client_EventNotificationCallback> innerEventCallbacks,
             Span<const UA_Client_DeleteMonitoredItemCallback> innerDeleteCallbacks
         ) {
+            detail::flushCoalescedRequests(connection);
             throwIfBad(UA_Client_MonitoredItems_createEvents_async(
                 opcua::detail::getHandle(connection),
                 asNative(innerRequest),
@@ -450,6 +477,7 @@ auto modifyMonitoredItemsAsync(
             void* userdata,
             const ModifyMonitoredItemsRequest& innerRequest
         ) {
+            detail::flushCoalescedRequests(connection);
             throwIfBad(UA_Client_MonitoredItems_modify_async(
                 opcua::detail::getHandle(connection),
                 asNative(innerRequest),
@@ -664,6 +692,7 @@ auto deleteMonitoredItemsAsync(
             void* userdata,
             const DeleteMonitoredItemsRequest& innerRequest
         ) {
+            detail::flushCoalescedRequests(connection);
             throwIfBad(UA_Client_MonitoredItems_delete_async(
                 opcua::detail::getHandle(connection),
                 asNative(innerRequest),
@@ -3,7 +3,7 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
-#include <utility>  // forward
+#include <utility>  // forward, pair
 
 #include "open62541pp/async.hpp"
 #include "open62541pp/config.hpp"
@@ -16,6 +16,8 @@
 #include "open62541pp/services/detail/request_handling.hpp"
 #include "open62541pp/services/detail/response_handling.hpp"
 #include "open62541pp/services/detail/subscription_context.hpp"
+#include "open62541pp/span.hpp"
+#include "open62541pp/types.hpp"  // DataValue
 #include "open62541pp/ua/types.hpp"  // IntegerId, StatusChangeNotification
 
 #ifdef UA_ENABLE_SUBSCRIPTIONS
@@ -88,6 +90,9 @@ std::unique_ptr<SubscriptionContext> createSubscriptionContext(
 void storeSubscriptionContext(
     Client& connection, IntegerId subscriptionId, std::unique_ptr<SubscriptionContext>&& context
 );
+
+/// Deliver the collected data changes of all subscriptions.
+void flushDataChangeBatches(Client& connection) noexcept;
 }  // namespace detail
 
 /**
@@ -140,6 +145,7 @@ auto createSubscriptionAsync(
             const CreateSubscriptionRequest& innerRequest,
             detail::SubscriptionContext* innerContextPtr
         ) {
+            detail::flushCoalescedRequests(connection);
             throwIfBad(UA_Client_Subscriptions_create_async(
                 opcua::detail::getHandle(connection),
                 asNative(innerRequest),
@@ -187,6 +193,30 @@ auto createSubscriptionAsync(
 }
 #endif
 
+/**
+ * Batch of data change notifications.
+ * @param subId Subscription identifier
+ * @param changes Pairs of monitored item identifier and changed value, values may be moved
+ */
+using DataChangeBatchCallback =
+    std::function<void(IntegerId subId, Span<std::pair<IntegerId, DataValue>> changes)>;
+
+/**
+ * Deliver the data change notifications of a subscription in batches.
+ * The data changes of all notification messages received within a client iteration are passed to
+ * a single callback invocation at the end of the iteration. The values are moved out of the
+ * received messages without copies. The batch callback replaces the data change callbacks of the
+ * subscription's monitored items, pass an empty callback to restore them. Data changes collected
+ * for the previous callback are delivered to it before it is replaced.
+ * @param connection Instance of type Client
+ * @param subscriptionId Identifier of a subscription created with @ref createSubscription
+ * @param callback Invoked with the batched data changes
+ * @exception BadStatus (BadSubscriptionIdInvalid) If the subscription is unknown
+ */
+void setDataChangeBatchCallback(
+    Client& connection, IntegerId subscriptionId, DataChangeBatchCallback callback
+);
+
 /**
  * @}
  * @defgroup ModifySubscription ModifySubscription service
@@ -229,6 +259,7 @@ auto modifySubscriptionAsync(
             void* userdata,
             const ModifySubscriptionRequest& innerRequest
         ) {
+            detail::flushCoalescedRequests(connection);
             throwIfBad(UA_Client_Subscriptions_modify_async(
                 opcua::detail::getHandle(connection),
                 asNative(innerRequest),
@@ -361,6 +392,7 @@ auto deleteSubscriptionsAsync(
             void* userdata,
             const DeleteSubscriptionsRequest& innerRequest
         ) {
+            detail::flushCoalescedRequests(connection);
             throwIfBad(UA_Client_Subscriptions_delete_async(
                 opcua::detail::getHandle(connection),
                 asNative(innerRequest),
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <cstddef>  // size_t
 #include <cstdint>
+#include <functional>
 #include <iterator>  // make_move_iterator
+#include <memory>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -230,7 +233,9 @@ template <typename T>
 BrowsePathResult browseSimplifiedBrowsePath(
     T& connection, const NodeId& origin, Span<const QualifiedName> browsePath
 ) {
-    return translateBrowsePathToNodeIds(connection, detail::makeBrowsePath(origin, browsePath));
+    const auto relativePathElements = detail::makeRelativePathElements(browsePath);
+    const auto path = detail::makeBrowsePath(origin, relativePathElements);
+    return translateBrowsePathToNodeIds(connection, asWrapper<BrowsePath>(path));
 }
 
 /**
@@ -245,8 +250,10 @@ auto browseSimplifiedBrowsePathAsync(
     Span<const QualifiedName> browsePath,
     CompletionToken&& token
 ) {
+    const auto relativePathElements = detail::makeRelativePathElements(browsePath);
+    const auto path = detail::makeBrowsePath(origin, relativePathElements);
     return translateBrowsePathToNodeIdsAsync(
-        connection, detail::makeBrowsePath(origin, browsePath), std::forward<CompletionToken>(token)
+        connection, asWrapper<BrowsePath>(path), std::forward<CompletionToken>(token)
     );
 }
 
@@ -348,6 +355,145 @@ Result<std::vector<ReferenceDescription>> browseAll(T& connection, const BrowseD
     return {std::move(refs), result.statusCode()};
 }
 
+/// Callback to stream the references of @ref browseAll(Client&, Span<const BrowseDescription>,
+/// const BrowseAllCallback&, const BrowseAllOptions&).
+/// The references of a node are delivered in one or more chunks and may be moved out.
+/// @param index Index of the browse description
+/// @param refs Chunk of references
+using BrowseAllCallback = std::function<void(size_t index, Span<ReferenceDescription> refs)>;
+
+/// Options of @ref browseAll(Client&, Span<const BrowseDescription>, const BrowseAllCallback&,
+/// const BrowseAllOptions&).
+struct BrowseAllOptions {
+    /// Maximum number of references per node and response (0 if no limit).
+    uint32_t maxReferencesPerNode = 0;
+    /// Maximum number of nodes or continuation points per request.
+    /// The server's `MaxNodesPerBrowse` operation limit is used if 0 (read once and cached).
+    size_t maxNodesPerRequest = 0;
+    /// Maximum number of Browse/BrowseNext requests in flight.
+    size_t maxRequestsInFlight = 4;
+};
+
+namespace detail {
+
+using BrowseAllHandler = std::function<void(std::vector<StatusCode>& results)>;
+
+void browseAllPipelinedAsync(
+    Client& connection,
+    Span<const BrowseDescription> bds,
+    const BrowseAllOptions& options,
+    BrowseAllCallback callback,
+    BrowseAllHandler handler
+);
+
+}  // namespace detail
+
+/**
+ * Discover all the references of multiple nodes (client only).
+ *
+ * The nodes are browsed with batched Browse requests, split by the `maxNodesPerRequest` option.
+ * Continuation points of all nodes are collected and followed concurrently with batched BrowseNext
+ * requests. Up to `maxRequestsInFlight` Browse/BrowseNext requests are pipelined.
+ * Nodes rejected with `BadNoContinuationPoints` are browsed again, once continuation points are
+ * released. The references are streamed to the callback instead of being accumulated.
+ *
+ * The operation always completes with the status of each node:
+ * - Nodes of requests that can not be sent get the status of the failed send.
+ * - If the callback throws, the operation is cancelled: no more requests are sent, the
+ *   references of pending responses are discarded and unfinished nodes get the status
+ *   `BadRequestCancelledByClient`. The exception is rethrown by Client::runIterate, the async
+ *   operation completes once all pending responses are received.
+ *   Held continuation points are released by the server when the session is closed.
+ *
+ * @param connection Instance of type Client
+ * @param bds Browse descriptions
+ * @param callback Callback to receive the references of each node
+ * @param options Browse options
+ * @return Status code of each node
+ */
+std::vector<StatusCode> browseAll(
+    Client& connection,
+    Span<const BrowseDescription> bds,
+    const BrowseAllCallback& callback,
+    const BrowseAllOptions& options = {}
+);
+
+/**
+ * @copydoc browseAll(Client&, Span<const BrowseDescription>, const BrowseAllCallback&,
+ *          const BrowseAllOptions&)
+ * @param token @completiontoken{void(std::vector<StatusCode>&)}
+ * @return @asyncresult{std::vector<StatusCode>}
+ */
+template <typename CompletionToken>
+auto browseAllAsync(
+    Client& connection,
+    Span<const BrowseDescription> bds,
+    BrowseAllCallback callback,
+    const BrowseAllOptions& options,
+    CompletionToken&& token
+) {
+    return asyncInitiate<std::vector<StatusCode>>(
+        [&connection](
+            auto&& handler,
+            const std::vector<BrowseDescription>& innerBds,
+            BrowseAllCallback innerCallback,
+            const BrowseAllOptions& innerOptions
+        ) {
+            // std::function requires copyable handlers
+            auto sharedHandler = std::make_shared<std::decay_t<decltype(handler)>>(
+                std::forward<decltype(handler)>(handler)
+            );
+            detail::browseAllPipelinedAsync(
+                connection,
+                innerBds,
+                innerOptions,
+                std::move(innerCallback),
+                [sharedHandler](std::vector<StatusCode>& results) {
+                    std::invoke(*sharedHandler, results);
+                }
+            );
+        },
+        std::forward<CompletionToken>(token),
+        std::vector<BrowseDescription>(bds.begin(), bds.end()),  // owned by deferred operations
+        std::move(callback),
+        options
+    );
+}
+
+/**
+ * Discover all the references of a specified node asynchronously (client only).
+ * The BrowseNext requests are pipelined with @ref browseAllAsync for multiple nodes.
+ * @param connection Instance of type Client
+ * @param bd Browse description
+ * @param token @completiontoken{void(Result<std::vector<ReferenceDescription>>&)}
+ * @return @asyncresult{Result<std::vector<ReferenceDescription>>}
+ */
+template <typename CompletionToken>
+auto browseAllAsync(Client& connection, const BrowseDescription& bd, CompletionToken&& token) {
+    auto refs = std::make_shared<std::vector<ReferenceDescription>>();
+    return browseAllAsync(
+        connection,
+        Span<const BrowseDescription>{&bd, 1},
+        [refs](size_t, Span<ReferenceDescription> chunk) {
+            refs->insert(
+                refs->end(),
+                std::make_move_iterator(chunk.begin()),
+                std::make_move_iterator(chunk.end())
+            );
+        },
+        BrowseAllOptions{},
+        detail::TransformToken(
+            [refs](std::vector<StatusCode>& results) -> Result<std::vector<ReferenceDescription>> {
+                if (results.empty()) {
+                    return BadResult{UA_STATUSCODE_BADUNEXPECTEDERROR};
+                }
+                return {std::move(*refs), results.front()};
+            },
+            std::forward<CompletionToken>(token)
+        )
+    );
+}
+
 /**
  * @}
  */
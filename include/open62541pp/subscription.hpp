@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <type_traits>
 #include <utility>  // move
 #include <vector>
@@ -7,8 +8,11 @@
 #include "open62541pp/common.hpp"  // AttributeId
 #include "open62541pp/config.hpp"
 #include "open62541pp/monitoreditem.hpp"
+#include "open62541pp/result.hpp"
 #include "open62541pp/services/monitoreditem.hpp"
 #include "open62541pp/services/subscription.hpp"
+#include "open62541pp/span.hpp"
+#include "open62541pp/typeregistry.hpp"  // getDataType, IsRegistered
 #include "open62541pp/types.hpp"
 #include "open62541pp/ua/types.hpp"  // IntegerId
 
@@ -23,6 +27,71 @@ using MonitoringParametersEx = services::MonitoringParametersEx;
 using DataChangeNotificationCallback = services::DataChangeNotificationCallback;
 using EventNotificationCallback = services::EventNotificationCallback;
 
+/**
+ * Typed data change notification callback.
+ * @param monId MonitoredItem identifier
+ * @param value Changed value, valid only during the callback
+ * @param sourceTimestamp Source timestamp of the value
+ */
+template <typename T>
+using TypedDataChangeCallback =
+    std::function<void(IntegerId monId, const T& value, DateTime sourceTimestamp)>;
+
+/**
+ * Error callback of typed data change notifications.
+ * @param monId MonitoredItem identifier
+ * @param code Bad status of the value or BadTypeMismatch if the value is not a scalar of the
+ *             expected type
+ */
+using DataChangeErrorCallback = std::function<void(IntegerId monId, StatusCode code)>;
+
+namespace detail {
+
+// Adapt a typed callback to a DataChangeNotificationCallback. The value is accessed in-place from
+// the native variant. The data type is validated once by its id, later notifications only compare
+// the type pointer.
+template <typename T>
+DataChangeNotificationCallback makeTypedDataChangeCallback(
+    TypedDataChangeCallback<T>&& onDataChange, DataChangeErrorCallback&& onError
+) {
+    static_assert(
+        IsRegistered<T>::value,
+        "Template type must be a native/wrapper type to access the value without copy"
+    );
+    return [expectedType = &getDataType<T>(),
+            onDataChange = std::move(onDataChange),
+            onError = std::move(onError)](IntegerId, IntegerId monId, const DataValue& dv) mutable {
+        const UA_DataValue& native = *dv.handle();
+        const UA_Variant& var = native.value;
+        if (native.hasStatus && StatusCode{native.status}.isBad()) {
+            if (onError) {
+                onError(monId, native.status);
+            }
+            return;
+        }
+        if (var.type != expectedType) {
+            if (var.type == nullptr || !UA_NodeId_equal(&var.type->typeId, &expectedType->typeId)) {
+                if (onError) {
+                    onError(monId, UA_STATUSCODE_BADTYPEMISMATCH);
+                }
+                return;
+            }
+            expectedType = var.type;  // e.g. custom type definition of the client config
+        }
+        if (!UA_Variant_isScalar(&var)) {
+            if (onError) {
+                onError(monId, UA_STATUSCODE_BADTYPEMISMATCH);
+            }
+            return;
+        }
+        if (onDataChange) {
+            onDataChange(monId, *static_cast<const T*>(var.data), DateTime{native.sourceTimestamp});
+        }
+    };
+}
+
+}  // namespace detail
+
 /**
  * High-level subscription class.
  *
@@ -87,6 +156,15 @@ public:
         services::setPublishingMode(connection(), subscriptionId(), publishing).throwIfBad();
     }
 
+    /// Deliver the data changes of all monitored items in batches, one callback per iteration.
+    /// @note Not implemented for Server.
+    /// @see services::setDataChangeBatchCallback
+    void setDataChangeBatchCallback(services::DataChangeBatchCallback onDataChanges) {
+        services::setDataChangeBatchCallback(
+            connection(), subscriptionId(), std::move(onDataChanges)
+        );
+    }
+
     /// Create a monitored item for data change notifications.
     MonitoredItem<Connection> subscribeDataChange(
         const NodeId& id,
@@ -120,6 +198,119 @@ public:
         );
     }
 
+    /// Create monitored items for data change notifications of multiple nodes.
+    /// Clients create all items with a single request, split by the `MaxMonitoredItemsPerCall`
+    /// operation limit of the server.
+    /// @return Monitored item or error for each node, in the order of `ids`
+    /// @see services::createMonitoredItemsDataChange
+    std::vector<Result<MonitoredItem<Connection>>> subscribeDataChanges(
+        Span<const NodeId> ids,
+        AttributeId attribute,
+        MonitoringMode monitoringMode,
+        const MonitoringParametersEx& parameters,
+        DataChangeNotificationCallback onDataChange
+    ) {
+        std::vector<ReadValueId> items;
+        items.reserve(ids.size());
+        for (const auto& id : ids) {
+            items.emplace_back(id, attribute);
+        }
+        std::vector<MonitoredItemCreateResult> results;
+        if constexpr (std::is_same_v<Connection, Server>) {
+            results.reserve(items.size());
+            for (const auto& item : items) {
+                results.push_back(services::createMonitoredItemDataChange(
+                    connection(),
+                    subscriptionId(),
+                    item,
+                    monitoringMode,
+                    parameters,
+                    onDataChange,
+                    {}
+                ));
+            }
+        } else {
+            results = services::createMonitoredItemsDataChange(
+                connection(),
+                subscriptionId(),
+                items,
+                monitoringMode,
+                parameters,
+                std::move(onDataChange),
+                {}
+            );
+        }
+        std::vector<Result<MonitoredItem<Connection>>> monitoredItems;
+        monitoredItems.reserve(results.size());
+        for (const auto& result : results) {
+            if (result.statusCode().isBad()) {
+                monitoredItems.emplace_back(BadResult{result.statusCode()});
+            } else {
+                monitoredItems.emplace_back(MonitoredItem<Connection>{
+                    connection(), subscriptionId(), result.monitoredItemId()
+                });
+            }
+        }
+        return monitoredItems;
+    }
+
+    /// Create monitored items for data change notifications of multiple nodes (default settings).
+    /// The monitoring mode is set to MonitoringMode::Reporting and the default open62541
+    /// MonitoringParametersEx are used.
+    std::vector<Result<MonitoredItem<Connection>>> subscribeDataChanges(
+        Span<const NodeId> ids, AttributeId attribute, DataChangeNotificationCallback onDataChange
+    ) {
+        const MonitoringParametersEx parameters;
+        return subscribeDataChanges(
+            ids, attribute, MonitoringMode::Reporting, parameters, std::move(onDataChange)
+        );
+    }
+
+    /**
+     * Create a monitored item for typed data change notifications.
+     * Values are passed to `onDataChange` as scalars of type `T` without copies or conversions.
+     * Bad values and values of other types are reported to `onError` instead.
+     * @tparam T Native or wrapper type of the monitored value, e.g. `double` or String
+     */
+    template <typename T>
+    MonitoredItem<Connection> subscribeDataChange(
+        const NodeId& id,
+        AttributeId attribute,
+        MonitoringMode monitoringMode,
+        const MonitoringParametersEx& parameters,
+        TypedDataChangeCallback<T> onDataChange,
+        DataChangeErrorCallback onError = {}
+    ) {
+        return subscribeDataChange(
+            id,
+            attribute,
+            monitoringMode,
+            parameters,
+            detail::makeTypedDataChangeCallback<T>(std::move(onDataChange), std::move(onError))
+        );
+    }
+
+    /// Create a monitored item for typed data change notifications (default settings).
+    /// The monitoring mode is set to MonitoringMode::Reporting and the default open62541
+    /// MonitoringParametersEx are used.
+    template <typename T>
+    MonitoredItem<Connection> subscribeDataChange(
+        const NodeId& id,
+        AttributeId attribute,
+        TypedDataChangeCallback<T> onDataChange,
+        DataChangeErrorCallback onError = {}
+    ) {
+        const MonitoringParametersEx parameters;
+        return subscribeDataChange<T>(
+            id,
+            attribute,
+            MonitoringMode::Reporting,
+            parameters,
+            std::move(onDataChange),
+            std::move(onError)
+        );
+    }
+
     /// Create a monitored item for event notifications.
     /// @note Not implemented for Server.
     MonitoredItem<Connection> subscribeEvent(
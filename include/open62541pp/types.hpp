@@ -345,6 +345,53 @@ struct TypeConverter<char[N]> {  // NOLINT(*c-arrays)
 
 UAPP_TYPEREGISTRY_NATIVE(String, UA_TYPES_STRING)
 
+/**
+ * Non-owning view of a UA_String.
+ *
+ * The view is layout-compatible with UA_String and implicitly convertible to `const String&`.
+ * It can be passed to all functions accepting a String without copying the character data.
+ * The referenced character data must outlive the view.
+ * @ingroup Wrapper
+ */
+class StringView {
+public:
+    constexpr StringView() noexcept = default;
+
+    explicit StringView(std::string_view str) noexcept
+        : native_{detail::toNativeString(str)} {}
+
+    const UA_String* handle() const noexcept {
+        return &native_;
+    }
+
+    size_t size() const noexcept {
+        return native_.length;
+    }
+
+    bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    const char* data() const noexcept {
+        return reinterpret_cast<const char*>(native_.data);  // NOLINT
+    }
+
+    /// Implicit conversion to std::string_view.
+    operator std::string_view() const noexcept {  // NOLINT(*-conversions)
+        return detail::toStringView(native_);
+    }
+
+    /// Implicit conversion to String.
+    operator const String&() const noexcept {  // NOLINT(*-conversions)
+        return asWrapper<String>(native_);
+    }
+
+private:
+    UA_String native_{};
+};
+
+static_assert(sizeof(StringView) == sizeof(UA_String));
+
 /* ------------------------------------------ DateTime ------------------------------------------ */
 
 /**
@@ -823,6 +870,59 @@ inline bool operator>=(const UA_NodeId& lhs, const UA_NodeId& rhs) noexcept {
 
 UAPP_TYPEREGISTRY_NATIVE(NodeId, UA_TYPES_NODEID)
 
+/**
+ * Non-owning view of a UA_NodeId.
+ *
+ * The view is layout-compatible with UA_NodeId and implicitly convertible to `const NodeId&`.
+ * It can be passed to all functions accepting a NodeId, e.g. services::readAttribute,
+ * services::writeAttribute or services::call, without allocations.
+ * String identifiers are referenced, not copied, and must outlive the view.
+ * @ingroup Wrapper
+ */
+class NodeIdView {
+public:
+    /// Create view with numeric identifier.
+    NodeIdView(NamespaceIndex namespaceIndex, uint32_t identifier) noexcept {
+        native_.namespaceIndex = namespaceIndex;
+        native_.identifierType = UA_NODEIDTYPE_NUMERIC;
+        native_.identifier.numeric = identifier;  // NOLINT
+    }
+
+    /// Create view with String identifier.
+    NodeIdView(NamespaceIndex namespaceIndex, std::string_view identifier) noexcept {
+        native_.namespaceIndex = namespaceIndex;
+        native_.identifierType = UA_NODEIDTYPE_STRING;
+        native_.identifier.string = detail::toNativeString(identifier);  // NOLINT
+    }
+
+    /// Create view from enum class with numeric identifiers like `opcua::ObjectId`.
+    template <typename T, typename = std::enable_if_t<detail::IsNodeIdEnum<T>::value>>
+    NodeIdView(T identifier) noexcept  // NOLINT(hicpp-explicit-conversions)
+        : NodeIdView(namespaceOf(identifier).index, static_cast<uint32_t>(identifier)) {}
+
+    const UA_NodeId* handle() const noexcept {
+        return &native_;
+    }
+
+    NamespaceIndex namespaceIndex() const noexcept {
+        return native_.namespaceIndex;
+    }
+
+    NodeIdType identifierType() const noexcept {
+        return static_cast<NodeIdType>(native_.identifierType);
+    }
+
+    /// Implicit conversion to NodeId.
+    operator const NodeId&() const noexcept {  // NOLINT(*-conversions)
+        return asWrapper<NodeId>(native_);
+    }
+
+private:
+    UA_NodeId native_{};
+};
+
+static_assert(sizeof(NodeIdView) == sizeof(UA_NodeId));
+
 /* --------------------------------------- ExpandedNodeId --------------------------------------- */
 
 /**
@@ -953,6 +1053,43 @@ inline bool operator!=(const UA_QualifiedName& lhs, const UA_QualifiedName& rhs)
 
 UAPP_TYPEREGISTRY_NATIVE(QualifiedName, UA_TYPES_QUALIFIEDNAME)
 
+/**
+ * Non-owning view of a UA_QualifiedName.
+ *
+ * The view is layout-compatible with UA_QualifiedName and implicitly convertible to
+ * `const QualifiedName&`. The referenced name must outlive the view.
+ * @ingroup Wrapper
+ */
+class QualifiedNameView {
+public:
+    QualifiedNameView(NamespaceIndex namespaceIndex, std::string_view name) noexcept {
+        native_.namespaceIndex = namespaceIndex;
+        native_.name = detail::toNativeString(name);
+    }
+
+    const UA_QualifiedName* handle() const noexcept {
+        return &native_;
+    }
+
+    NamespaceIndex namespaceIndex() const noexcept {
+        return native_.namespaceIndex;
+    }
+
+    std::string_view name() const noexcept {
+        return detail::toStringView(native_.name);
+    }
+
+    /// Implicit conversion to QualifiedName.
+    operator const QualifiedName&() const noexcept {  // NOLINT(*-conversions)
+        return asWrapper<QualifiedName>(native_);
+    }
+
+private:
+    UA_QualifiedName native_{};
+};
+
+static_assert(sizeof(QualifiedNameView) == sizeof(UA_QualifiedName));
+
 /* ---------------------------------------- LocalizedText --------------------------------------- */
 
 /**
@@ -0,0 +1,333 @@
+#include "open62541pp/addressspacecrawler.hpp"
+
+#include <array>
+#include <cstring>  // memcmp
+#include <istream>
+#include <ostream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "open62541pp/client.hpp"
+#include "open62541pp/exception.hpp"
+#include "open62541pp/services/view.hpp"
+
+namespace opcua {
+
+/* ------------------------------------- AddressSpaceCrawler ------------------------------------ */
+
+namespace {
+
+/// State of a crawl, shared with the callbacks of pending requests.
+struct CrawlState {
+    Client& connection;
+    AddressSpaceCrawlerOptions options;
+    AddressSpaceCrawler::Callback callback;
+    std::function<void(CrawlStatistics&)> handler;
+
+    struct Pending {
+        const NodeId* id;  // element of the visited set (stable address)
+        size_t index;
+    };
+
+    std::unordered_set<NodeId> visited;
+    std::vector<Pending> frontier;  // nodes of the current level
+    std::vector<Pending> nextFrontier;
+    uint32_t depth{0};
+    CrawlStatistics statistics{};
+};
+
+}  // namespace
+
+static bool isReported(const CrawlState& state, NodeClass nodeClass) noexcept {
+    const auto mask = state.options.nodeClassMask;
+    return mask == NodeClass::Unspecified || mask.allOf(nodeClass);
+}
+
+static void discover(
+    CrawlState& state, ReferenceDescription& ref, size_t parentIndex, bool expand
+) {
+    if (!ref.nodeId().isLocal()) {
+        return;
+    }
+    auto [it, inserted] = state.visited.insert(std::move(ref.nodeId().nodeId()));
+    if (!inserted) {
+        return;
+    }
+    const size_t index = state.statistics.discoveredNodes++;
+    if (expand) {
+        state.nextFrontier.push_back({&*it, index});
+    }
+    if (isReported(state, ref.nodeClass())) {
+        CrawledNode node{
+            index,
+            parentIndex,
+            state.depth + 1,
+            *it,
+            std::move(ref.referenceTypeId()),
+            ref.nodeClass(),
+            std::move(ref.browseName()),
+        };
+        ++state.statistics.reportedNodes;
+        state.callback(node);
+    }
+}
+
+static void crawlLevel(const std::shared_ptr<CrawlState>& state) {
+    if (state->frontier.empty()) {
+        state->handler(state->statistics);
+        return;
+    }
+    const auto& options = state->options;
+    std::vector<BrowseDescription> bds;
+    bds.reserve(state->frontier.size());
+    for (const auto& pending : state->frontier) {
+        bds.emplace_back(
+            *pending.id,
+            options.browseDirection,
+            options.referenceTypeId,
+            options.includeSubtypes,
+            NodeClass::Unspecified,  // traverse all, filter reported nodes
+            BrowseResultMask::ReferenceTypeId | BrowseResultMask::NodeClass |
+                BrowseResultMask::BrowseName
+        );
+    }
+    services::BrowseAllOptions browseOptions;
+    browseOptions.maxNodesPerRequest = options.maxNodesPerRequest;
+    browseOptions.maxRequestsInFlight = options.maxRequestsInFlight;
+    // expand nodes of the next level only within the depth limit
+    const bool expand = options.maxDepth == 0 || state->depth + 2 <= options.maxDepth;
+
+    services::detail::browseAllPipelinedAsync(
+        state->connection,
+        bds,
+        browseOptions,
+        [state, expand](size_t index, Span<ReferenceDescription> refs) {
+            const size_t parentIndex = state->frontier.at(index).index;
+            for (auto& ref : refs) {
+                discover(*state, ref, parentIndex, expand);
+            }
+        },
+        [state](std::vector<StatusCode>& results) {
+            for (const auto& status : results) {
+                state->statistics.browseErrors += status.isBad() ? 1 : 0;
+            }
+            state->frontier = std::move(state->nextFrontier);
+            state->nextFrontier.clear();
+            ++state->depth;
+            crawlLevel(state);
+        }
+    );
+}
+
+void AddressSpaceCrawler::crawlAsyncImpl(
+    Span<const NodeId> startNodes, Callback callback, CompletionHandler handler
+) {
+    auto state = std::make_shared<CrawlState>(CrawlState{
+        connection_, options_, std::move(callback), std::move(handler), {}, {}, {}, 0, {}
+    });
+    for (const auto& id : startNodes) {
+        auto [it, inserted] = state->visited.insert(id);
+        if (!inserted) {
+            continue;
+        }
+        const size_t index = state->statistics.discoveredNodes++;
+        state->frontier.push_back({&*it, index});
+        CrawledNode node{index, CrawledNode::npos, 0, id, {}, NodeClass::Unspecified, {}};
+        ++state->statistics.reportedNodes;
+        state->callback(node);
+    }
+    crawlLevel(state);
+}
+
+CrawlStatistics AddressSpaceCrawler::crawl(
+    Span<const NodeId> startNodes, const Callback& callback
+) {
+    // shared with the callbacks, which might outlive this function if an exception is thrown
+    struct State {
+        CrawlStatistics statistics{};
+        bool done{false};
+        bool cancelled{false};
+    };
+    auto state = std::make_shared<State>();
+    try {
+        crawlAsyncImpl(
+            startNodes,
+            [state, &callback](CrawledNode& node) {
+                if (!state->cancelled && callback) {
+                    callback(node);
+                }
+            },
+            [state](CrawlStatistics& statistics) {
+                state->statistics = statistics;
+                state->done = true;
+            }
+        );
+        while (!state->done) {
+            connection_.runIterate();
+        }
+    } catch (...) {
+        state->cancelled = true;
+        throw;
+    }
+    return state->statistics;
+}
+
+/* --------------------------------------- Snapshot files --------------------------------------- */
+
+static constexpr std::array<char, 8> snapshotMagic{'U', 'A', 'P', 'P', 'S', 'N', 'A', 'P'};
+static constexpr uint64_t snapshotVersion = 1;
+static constexpr uint64_t snapshotMaxLength = 1U << 24U;  // sanity check of decoded lengths
+
+static void writeVarint(std::ostream& stream, uint64_t value) {
+    while (value >= 0x80U) {
+        stream.put(static_cast<char>((value & 0x7FU) | 0x80U));
+        value >>= 7U;
+    }
+    stream.put(static_cast<char>(value));
+}
+
+static void writeBytes(std::ostream& stream, const void* data, size_t length) {
+    writeVarint(stream, length);
+    stream.write(static_cast<const char*>(data), static_cast<std::streamsize>(length));
+}
+
+static void writeNodeId(std::ostream& stream, const NodeId& id) {
+    const auto& native = *id.handle();
+    writeVarint(stream, native.namespaceIndex);
+    stream.put(static_cast<char>(native.identifierType));
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-union-access)
+    switch (native.identifierType) {
+    case UA_NODEIDTYPE_NUMERIC:
+        writeVarint(stream, native.identifier.numeric);
+        break;
+    case UA_NODEIDTYPE_STRING:
+    case UA_NODEIDTYPE_BYTESTRING:
+        // string and byteString share the same layout
+        writeBytes(stream, native.identifier.string.data, native.identifier.string.length);
+        break;
+    case UA_NODEIDTYPE_GUID: {
+        const auto& guid = native.identifier.guid;
+        writeVarint(stream, guid.data1);
+        writeVarint(stream, guid.data2);
+        writeVarint(stream, guid.data3);
+        stream.write(reinterpret_cast<const char*>(guid.data4), sizeof(guid.data4));  // NOLINT
+        break;
+    }
+    default:
+        throw BadStatus{UA_STATUSCODE_BADENCODINGERROR};
+    }
+    // NOLINTEND(cppcoreguidelines-pro-type-union-access)
+}
+
+AddressSpaceSnapshotWriter::AddressSpaceSnapshotWriter(std::ostream& stream)
+    : stream_{&stream} {
+    stream_->write(snapshotMagic.data(), snapshotMagic.size());
+    writeVarint(*stream_, snapshotVersion);
+}
+
+void AddressSpaceSnapshotWriter::write(const CrawledNode& node) {
+    writeVarint(*stream_, node.index);
+    writeVarint(*stream_, node.parentIndex == CrawledNode::npos ? 0 : node.parentIndex + 1);
+    writeVarint(*stream_, node.depth);
+    writeNodeId(*stream_, node.nodeId);
+    writeNodeId(*stream_, node.referenceTypeId);
+    writeVarint(*stream_, static_cast<uint64_t>(node.nodeClass));
+    writeVarint(*stream_, node.browseName.namespaceIndex());
+    const auto name = node.browseName.name();
+    writeBytes(*stream_, name.data(), name.size());
+    if (!*stream_) {
+        throw BadStatus{UA_STATUSCODE_BADENCODINGERROR};
+    }
+}
+
+[[noreturn]] static void throwDecodingError() {
+    throw BadStatus{UA_STATUSCODE_BADDECODINGERROR};
+}
+
+static uint8_t readByte(std::istream& stream) {
+    const auto c = stream.get();
+    if (c == std::istream::traits_type::eof()) {
+        throwDecodingError();
+    }
+    return static_cast<uint8_t>(c);
+}
+
+static uint64_t readVarint(std::istream& stream) {
+    uint64_t value = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7) {
+        const uint8_t byte = readByte(stream);
+        value |= static_cast<uint64_t>(byte & 0x7FU) << shift;
+        if ((byte & 0x80U) == 0) {
+            return value;
+        }
+    }
+    throwDecodingError();
+}
+
+static std::string readBytes(std::istream& stream) {
+    const uint64_t length = readVarint(stream);
+    if (length > snapshotMaxLength) {
+        throwDecodingError();
+    }
+    std::string bytes(length, '\0');
+    stream.read(bytes.data(), static_cast<std::streamsize>(length));
+    if (static_cast<uint64_t>(stream.gcount()) != length) {
+        throwDecodingError();
+    }
+    return bytes;
+}
+
+static NodeId readNodeId(std::istream& stream) {
+    const auto ns = static_cast<NamespaceIndex>(readVarint(stream));
+    switch (readByte(stream)) {
+    case UA_NODEIDTYPE_NUMERIC:
+        return {ns, static_cast<uint32_t>(readVarint(stream))};
+    case UA_NODEIDTYPE_STRING:
+        return {ns, std::string_view{readBytes(stream)}};
+    case UA_NODEIDTYPE_BYTESTRING: {
+        const auto bytes = readBytes(stream);
+        return {ns, ByteString{bytes}};
+    }
+    case UA_NODEIDTYPE_GUID: {
+        const auto data1 = static_cast<uint32_t>(readVarint(stream));
+        const auto data2 = static_cast<uint16_t>(readVarint(stream));
+        const auto data3 = static_cast<uint16_t>(readVarint(stream));
+        std::array<uint8_t, 8> data4{};
+        for (auto& byte : data4) {
+            byte = readByte(stream);
+        }
+        return {ns, Guid{data1, data2, data3, data4}};
+    }
+    default:
+        throwDecodingError();
+    }
+}
+
+void readAddressSpaceSnapshot(
+    std::istream& stream, const std::function<void(CrawledNode& node)>& callback
+) {
+    std::array<char, snapshotMagic.size()> magic{};
+    stream.read(magic.data(), magic.size());
+    if (std::memcmp(magic.data(), snapshotMagic.data(), magic.size()) != 0 ||
+        readVarint(stream) != snapshotVersion) {
+        throwDecodingError();
+    }
+    while (stream.peek() != std::istream::traits_type::eof()) {
+        CrawledNode node{};
+        node.index = readVarint(stream);
+        const uint64_t parent = readVarint(stream);
+        node.parentIndex = parent == 0 ? CrawledNode::npos : parent - 1;
+        node.depth = static_cast<uint32_t>(readVarint(stream));
+        node.nodeId = readNodeId(stream);
+        node.referenceTypeId = readNodeId(stream);
+        node.nodeClass = static_cast<NodeClass>(readVarint(stream));
+        const auto ns = static_cast<NamespaceIndex>(readVarint(stream));
+        node.browseName = QualifiedName{ns, readBytes(stream)};
+        if (callback) {
+            callback(node);
+        }
+    }
+}
+
+}  // namespace opcua
@@ -0,0 +1,166 @@
+#include "open62541pp/arena.hpp"
+
+#if UAPP_HAS_ARENA
+
+#include <algorithm>  // max, min
+#include <cstring>  // memcpy, memset
+#include <new>  // nothrow
+
+#include "open62541pp/detail/open62541/common.h"
+
+namespace opcua {
+
+// Each allocation is prefixed by a header with its size, required to implement realloc.
+// The header size keeps the default alignment of malloc.
+static constexpr size_t headerSize = alignof(std::max_align_t);
+
+static constexpr size_t alignUp(size_t size) noexcept {
+    return (size + headerSize - 1) & ~(headerSize - 1);
+}
+
+static size_t& sizeOf(void* ptr) noexcept {
+    return *reinterpret_cast<size_t*>(static_cast<std::byte*>(ptr) - headerSize);  // NOLINT
+}
+
+// open62541 stores the allocator singletons thread-locally, so do we
+struct Allocator {
+    void* (*malloc)(size_t size);
+    void (*free)(void* ptr);
+    void* (*calloc)(size_t nelem, size_t elsize);
+    void* (*realloc)(void* ptr, size_t size);
+};
+
+static thread_local ArenaScope* currentArena = nullptr;  // NOLINT
+static thread_local Allocator previousAllocator{};  // NOLINT
+
+ArenaScope::ArenaScope(size_t blockSize)
+    : parent_{currentArena},
+      nextBlockSize_{std::max(blockSize, headerSize)} {
+    if (parent_ == nullptr) {
+        // install allocator only once for the outermost scope
+        previousAllocator = {
+            UA_mallocSingleton, UA_freeSingleton, UA_callocSingleton, UA_reallocSingleton
+        };
+        UA_mallocSingleton = mallocNative;
+        UA_freeSingleton = freeNative;
+        UA_callocSingleton = callocNative;
+        UA_reallocSingleton = reallocNative;
+    }
+    currentArena = this;
+}
+
+ArenaScope::~ArenaScope() {
+    currentArena = parent_;
+    if (parent_ == nullptr) {
+        UA_mallocSingleton = previousAllocator.malloc;
+        UA_freeSingleton = previousAllocator.free;
+        UA_callocSingleton = previousAllocator.calloc;
+        UA_reallocSingleton = previousAllocator.realloc;
+    }
+}
+
+bool ArenaScope::owns(const void* ptr) const noexcept {
+    const auto* bytes = static_cast<const std::byte*>(ptr);
+    return std::any_of(blocks_.begin(), blocks_.end(), [&](const Block& block) {
+        return bytes >= block.data.get() && bytes < block.data.get() + block.size;
+    });
+}
+
+void* ArenaScope::allocate(size_t size) noexcept {
+    const size_t required = headerSize + alignUp(size);
+    if (required < size) {
+        return nullptr;  // overflow
+    }
+    if (static_cast<size_t>(end_ - cursor_) < required) {
+        const size_t blockSize = std::max(nextBlockSize_, required);
+        auto* data = new (std::nothrow) std::byte[blockSize];
+        if (data == nullptr) {
+            return nullptr;
+        }
+        blocks_.push_back({std::unique_ptr<std::byte[]>(data), blockSize});  // NOLINT
+        cursor_ = data;
+        end_ = data + blockSize;  // NOLINT
+        bytesReserved_ += blockSize;
+        nextBlockSize_ = std::min(2 * nextBlockSize_, size_t{64} * 1024 * 1024);
+    }
+    void* ptr = cursor_ + headerSize;  // NOLINT
+    cursor_ += required;  // NOLINT
+    bytesAllocated_ += size;
+    sizeOf(ptr) = size;
+    return ptr;
+}
+
+void* ArenaScope::reallocate(void* ptr, size_t size) noexcept {
+    const size_t oldSize = sizeOf(ptr);
+    if (size <= oldSize) {
+        sizeOf(ptr) = size;
+        return ptr;
+    }
+    // grow in place if ptr is the most recent allocation
+    auto* bytes = static_cast<std::byte*>(ptr);
+    if (bytes + alignUp(oldSize) == cursor_ &&
+        static_cast<size_t>(end_ - bytes) >= alignUp(size)) {
+        cursor_ = bytes + alignUp(size);  // NOLINT
+        bytesAllocated_ += size - oldSize;
+        sizeOf(ptr) = size;
+        return ptr;
+    }
+    void* newPtr = allocate(size);
+    if (newPtr != nullptr) {
+        std::memcpy(newPtr, ptr, oldSize);
+    }
+    return newPtr;
+}
+
+void* ArenaScope::mallocNative(size_t size) {
+    return currentArena->allocate(size);
+}
+
+void* ArenaScope::callocNative(size_t nelem, size_t elsize) {
+    const size_t size = nelem * elsize;
+    if (elsize != 0 && size / elsize != nelem) {
+        return nullptr;  // overflow
+    }
+    void* ptr = currentArena->allocate(size);
+    if (ptr != nullptr) {
+        std::memset(ptr, 0, size);
+    }
+    return ptr;
+}
+
+void* ArenaScope::reallocNative(void* ptr, size_t size) {
+    if (ptr == nullptr) {
+        return currentArena->allocate(size);
+    }
+    for (auto* arena = currentArena; arena != nullptr; arena = arena->parent_) {
+        if (!arena->owns(ptr)) {
+            continue;
+        }
+        if (arena == currentArena) {
+            return arena->reallocate(ptr, size);
+        }
+        // memory of an outer arena, move it to the innermost arena
+        void* newPtr = currentArena->allocate(size);
+        if (newPtr != nullptr) {
+            std::memcpy(newPtr, ptr, std::min(sizeOf(ptr), size));
+        }
+        return newPtr;
+    }
+    return previousAllocator.realloc(ptr, size);
+}
+
+void ArenaScope::freeNative(void* ptr) {
+    if (ptr == nullptr) {
+        return;
+    }
+    for (auto* arena = currentArena; arena != nullptr; arena = arena->parent_) {
+        if (arena->owns(ptr)) {
+            return;  // released with the arena
+        }
+    }
+    previousAllocator.free(ptr);
+}
+
+}  // namespace opcua
+
+#endif  // if UAPP_HAS_ARENA
@@ -1,5 +1,6 @@
 #include "open62541pp/client.hpp"
 
+#include <algorithm>  // sort
 #include <cassert>
 #include <iterator>
 #include <utility>  // move
@@ -192,6 +193,7 @@ static void stateCallback(UA_Client* client, UA_ClientState clientState) noexcep
             invokeStateCallback(*context, detail::ClientState::Connected);
             break;
         case UA_CLIENTSTATE_SESSION:
+            context->operationLimits = {};
             invokeStateCallback(*context, detail::ClientState::SessionActivated);
             break;
         case UA_CLIENTSTATE_SESSION_DISCONNECTED:
@@ -219,6 +221,7 @@ static void stateCallback(
     if (sessionState != context->lastSessionState) {
         switch (sessionState) {
         case UA_SESSIONSTATE_ACTIVATED:
+            context->operationLimits = {};
             invokeStateCallback(*context, detail::ClientState::SessionActivated);
             break;
         case UA_SESSIONSTATE_CLOSED:
@@ -435,16 +438,41 @@ std::vector<String> Client::namespaceArray() {
 
 #ifdef UA_ENABLE_SUBSCRIPTIONS
 std::vector<Subscription<Client>> Client::subscriptions() {
-    std::vector<Subscription<Client>> result;
+    std::vector<IntegerId> subIds;
     auto& subscriptions = context().subscriptions;
     subscriptions.eraseStale();
-    subscriptions.iterate([&](const auto& pair) { result.emplace_back(*this, pair.first); });
+    subscriptions.iterate([&](const auto& pair) { subIds.push_back(pair.first); });
+    // hash map iteration order is unspecified, keep results sorted by id
+    std::sort(subIds.begin(), subIds.end());
+    std::vector<Subscription<Client>> result;
+    result.reserve(subIds.size());
+    for (const auto subId : subIds) {
+        result.emplace_back(*this, subId);
+    }
     return result;
 }
 #endif
 
+void Client::setRequestCoalescing(bool enabled, size_t maxItems) {
+    if (!enabled) {
+        context().coalescer.flush(handle());
+    }
+    context().coalescer.setEnabled(enabled, maxItems);
+}
+
+HandlerStatistics Client::handlerStatistics() const {
+    const auto statistics = context().handlerSlab.statistics();
+    return {statistics.chunkAllocations, statistics.heapAllocations, statistics.slotsInUse};
+}
+
 void Client::runIterate(uint16_t timeoutMilliseconds) {
-    throwIfBad(UA_Client_run_iterate(handle(), timeoutMilliseconds));
+    context().coalescer.flush(handle());
+    const UA_StatusCode status = UA_Client_run_iterate(handle(), timeoutMilliseconds);
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+    // deliver data changes received before an error, e.g. before the connection was closed
+    services::detail::flushDataChangeBatches(*this);
+#endif
+    throwIfBad(status);
     context().exceptionCatcher.rethrow();
 }
 
@@ -533,6 +561,10 @@ ExceptionCatcher& getExceptionCatcher(Client& client) noexcept {
     return getContext(client).exceptionCatcher;
 }
 
+HandlerSlab& getHandlerSlab(Client& client) noexcept {
+    return getContext(client).handlerSlab;
+}
+
 UA_Client* getHandle(Client& client) noexcept {
     return client.handle();
 }
@@ -0,0 +1,182 @@
+#include "open62541pp/clientpool.hpp"
+
+#include <algorithm>  // max
+#include <stdexcept>  // invalid_argument
+#include <utility>  // move
+
+#include "open62541pp/config.hpp"
+#include "open62541pp/detail/client_context.hpp"
+#include "open62541pp/detail/client_utils.hpp"
+#include "open62541pp/exception.hpp"
+
+namespace opcua {
+
+// Index of the connected member with the lowest cost, ties are resolved in order from `start`.
+// Returns `start` if no member is connected.
+template <typename Members, typename Cost>
+static size_t selectMember(Members& members, size_t start, Cost&& cost) {
+    size_t selected = start;
+    bool found = false;
+    size_t minCost = 0;
+    for (size_t i = 0; i < members.size(); ++i) {
+        const size_t index = (start + i) % members.size();
+        auto& client = members[index].client;
+        if (!client.isConnected()) {
+            continue;
+        }
+        const size_t currentCost = cost(client);
+        if (!found || currentCost < minCost) {
+            selected = index;
+            minCost = currentCost;
+            found = true;
+        }
+    }
+    return selected;
+}
+
+ClientPool::ClientPool(
+    size_t size, const ConfigFactory& configFactory, LoadBalancing loadBalancing
+)
+    : loadBalancing_{loadBalancing} {
+    if (size == 0) {
+        throw std::invalid_argument("ClientPool size must be greater than 0");
+    }
+    members_.reserve(size);
+    for (size_t i = 0; i < size; ++i) {
+        members_.push_back({configFactory ? Client{configFactory()} : Client{}});
+        members_.back().client.onDisconnected([this, i] {
+            members_[i].connecting = false;
+            if (!endpointUrl_.empty()) {
+                members_[i].reconnect = true;
+            }
+        });
+    }
+}
+
+ClientPool::~ClientPool() {
+    endpointUrl_.clear();
+    for (auto& member : members_) {
+        member.client.onDisconnected(nullptr);
+    }
+}
+
+size_t ClientPool::connectedCount() {
+    return std::count_if(members_.begin(), members_.end(), [](Member& member) {
+        return member.client.isConnected();
+    });
+}
+
+void ClientPool::connect(std::string_view endpointUrl) {
+    endpointUrl_ = endpointUrl;
+    const auto now = std::chrono::steady_clock::now();
+    for (auto& member : members_) {
+        member.reconnect = true;  // retried within runIterate if the connection fails
+        member.lastAttempt = now;
+    }
+    for (auto& member : members_) {
+        member.client.connect(endpointUrl_);
+        member.reconnect = false;
+    }
+}
+
+void ClientPool::disconnect() {
+    endpointUrl_.clear();
+    for (auto& member : members_) {
+        member.reconnect = false;
+        member.connecting = false;
+        member.client.disconnect();
+    }
+}
+
+Client& ClientPool::next() {
+    size_t selected = cursor_;
+    switch (loadBalancing_) {
+    case LoadBalancing::RoundRobin:
+        selected = selectMember(members_, cursor_, [](Client&) { return size_t{0}; });
+        break;
+    case LoadBalancing::LeastOutstandingRequests:
+        selected = selectMember(members_, cursor_, [](Client& client) {
+            return client.handlerStatistics().slotsInUse;
+        });
+        break;
+    }
+    cursor_ = (selected + 1) % members_.size();
+    return members_[selected].client;
+}
+
+Client& ClientPool::nextForMonitoredItems() {
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+    const size_t selected = selectMember(members_, cursor_, [](Client& client) {
+        return detail::getContext(client).monitoredItems.size();
+    });
+    cursor_ = (selected + 1) % members_.size();
+    return members_[selected].client;
+#else
+    return next();
+#endif
+}
+
+void ClientPool::reconnect(Member& member) {
+    const auto now = std::chrono::steady_clock::now();
+    if (now - member.lastAttempt < reconnectInterval_) {
+        return;
+    }
+    member.lastAttempt = now;
+    member.reconnect = false;  // set again by the onDisconnected callback if the attempt fails
+    try {
+        member.client.connectAsync(endpointUrl_);
+        member.connecting = true;
+    } catch (const BadStatus&) {
+        member.reconnect = true;
+    }
+}
+
+void ClientPool::runIterate(uint16_t timeoutMilliseconds) {
+    const auto memberTimeout = static_cast<uint16_t>(
+        timeoutMilliseconds == 0 ? 0 : std::max<size_t>(1, timeoutMilliseconds / members_.size())
+    );
+    const auto now = std::chrono::steady_clock::now();
+    for (auto& member : members_) {
+        // a pending attempt ends with the connection, the onDisconnected callback or the timeout
+        if (member.connecting) {
+            const std::chrono::milliseconds timeout{member.client.config()->timeout};
+            member.connecting = !member.client.isConnected() && now - member.lastAttempt < timeout;
+        }
+        // the flag is set by the onDisconnected callback, failed attempts may not change the state
+        if (!endpointUrl_.empty() && !member.connecting &&
+            (member.reconnect || !member.client.isConnected())) {
+            reconnect(member);
+        }
+        try {
+            member.client.runIterate(memberTimeout);
+        } catch (const BadStatus&) {
+            if (member.client.isConnected()) {
+                throw;  // e.g. from completion handlers
+            }
+            // connection errors of dead members must not stall the other members
+            member.connecting = false;
+            member.reconnect = !endpointUrl_.empty();
+        }
+    }
+}
+
+void ClientPool::run() {
+    if (running_) {
+        return;
+    }
+    running_ = true;
+    try {
+        while (running_) {
+            runIterate(10);
+        }
+    } catch (...) {
+        running_ = false;
+        throw;
+    }
+}
+
+void ClientPool::stop() {
+    running_ = false;
+}
+
+}  // namespace opcua
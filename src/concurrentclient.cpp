@@ -0,0 +1,73 @@
+#include "open62541pp/concurrentclient.hpp"
+
+#include <algorithm>  // clamp
+#include <cstdint>
+#include <exception>
+#include <string_view>
+#include <thread>
+
+#include "open62541pp/detail/client_utils.hpp"
+#include "open62541pp/exception.hpp"
+
+namespace opcua {
+
+static void logException(Client& client, std::string_view exceptionMessage) {
+    // NOLINTNEXTLINE
+    UA_LOG_WARNING(
+        detail::getLogger(client.config().handle()),
+        UA_LOGCATEGORY_CLIENT,
+        "Exception in concurrent client task: %.*s",
+        static_cast<int>(exceptionMessage.size()),
+        exceptionMessage.data()
+    );
+}
+
+ConcurrentClient::ConcurrentClient(Client&& client, std::chrono::milliseconds iterateTimeout)
+    : client_{std::move(client)},
+      iterateTimeout_{iterateTimeout},
+      thread_{[this] { run(); }} {}
+
+ConcurrentClient::~ConcurrentClient() {
+    stopped_ = true;
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void ConcurrentClient::post(Task task) {
+    queue_.push(std::move(task));
+}
+
+void ConcurrentClient::run() {
+    const auto timeout = static_cast<uint16_t>(
+        std::clamp<std::chrono::milliseconds::rep>(iterateTimeout_.count(), 0, UINT16_MAX)
+    );
+    while (true) {
+        // read the flag before draining the queue, tasks posted before stop are executed
+        const bool stopped = stopped_;
+        while (auto task = queue_.pop()) {
+            try {
+                (*task)(client_);
+            } catch (const std::exception& e) {
+                logException(client_, e.what());
+            } catch (...) {
+                logException(client_, "unknown exception");
+            }
+        }
+        if (stopped) {
+            break;
+        }
+        try {
+            client_.runIterate(queue_.empty() ? timeout : 0);
+        } catch (const BadStatus&) {
+            // connection errors are reported by the state callbacks, avoid busy looping
+            std::this_thread::sleep_for(iterateTimeout_);
+        } catch (const std::exception& e) {
+            logException(client_, e.what());
+        } catch (...) {
+            logException(client_, "unknown exception");
+        }
+    }
+}
+
+}  // namespace opcua
@@ -0,0 +1,67 @@
+#include "open62541pp/datachangering.hpp"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+#include <cstdint>
+#include <limits>
+
+#include "open62541pp/typeregistry.hpp"  // getDataType
+
+namespace opcua {
+
+services::DataChangeBatchCallback makeDataChangeSink(
+    DataChangeRing<std::pair<IntegerId, DataValue>>& ring
+) {
+    return [&ring](IntegerId /* subId */, Span<std::pair<IntegerId, DataValue>> changes) {
+        for (auto& change : changes) {
+            ring.push(std::move(change));
+        }
+    };
+}
+
+// compare data type pointers instead of type ids, the values are decoded with the builtin types
+template <typename... Ts>
+static bool convertScalar(const Variant& var, double& result) noexcept {
+    return (
+        (var.type() == &getDataType<Ts>()
+             ? (result = static_cast<double>(*static_cast<const Ts*>(var.data())), true)
+             : false) ||
+        ...
+    );
+}
+
+static NumericDataChange makeNumericDataChange(IntegerId monId, const DataValue& dv) noexcept {
+    NumericDataChange change{
+        monId, std::numeric_limits<double>::quiet_NaN(), dv.sourceTimestamp(), dv.status()
+    };
+    const auto& var = dv.value();
+    const bool converted = var.isScalar() &&
+                           convertScalar<
+                               double,
+                               float,
+                               int64_t,
+                               uint64_t,
+                               int32_t,
+                               uint32_t,
+                               int16_t,
+                               uint16_t,
+                               int8_t,
+                               uint8_t,
+                               bool>(var, change.value);
+    if (!converted && change.status.isGood()) {
+        change.status = UA_STATUSCODE_BADTYPEMISMATCH;
+    }
+    return change;
+}
+
+services::DataChangeBatchCallback makeDataChangeSink(DataChangeRing<NumericDataChange>& ring) {
+    return [&ring](IntegerId /* subId */, Span<std::pair<IntegerId, DataValue>> changes) {
+        for (const auto& [monId, value] : changes) {
+            ring.push(makeNumericDataChange(monId, value));
+        }
+    };
+}
+
+}  // namespace opcua
+
+#endif
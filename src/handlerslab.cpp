@@ -0,0 +1,50 @@
+#include "open62541pp/detail/handlerslab.hpp"
+
+#include <new>  // align_val_t
+
+namespace opcua::detail {
+
+void* HandlerSlab::allocate(size_t size, size_t alignment) {
+    if (!fits(size, alignment)) {
+        {
+            std::scoped_lock lock{mutex_};
+            ++heapAllocations_;
+        }
+        return ::operator new(size, std::align_val_t{alignment});
+    }
+    std::scoped_lock lock{mutex_};
+    if (free_ == nullptr) {
+        auto chunk = std::make_unique<Slot[]>(slotsPerChunk);  // NOLINT(*avoid-c-arrays)
+        for (size_t i = 0; i < slotsPerChunk; ++i) {
+            chunk[i].next = free_;
+            free_ = &chunk[i];
+        }
+        chunks_.push_back(std::move(chunk));
+    }
+    Slot* slot = free_;
+    free_ = slot->next;
+    ++slotsInUse_;
+    return slot->storage;
+}
+
+void HandlerSlab::deallocate(void* ptr, size_t size, size_t alignment) noexcept {
+    if (ptr == nullptr) {
+        return;
+    }
+    if (!fits(size, alignment)) {
+        ::operator delete(ptr, std::align_val_t{alignment});
+        return;
+    }
+    auto* slot = static_cast<Slot*>(ptr);
+    std::scoped_lock lock{mutex_};
+    slot->next = free_;
+    free_ = slot;
+    --slotsInUse_;
+}
+
+HandlerSlab::Statistics HandlerSlab::statistics() const {
+    std::scoped_lock lock{mutex_};
+    return {chunks_.size(), heapAllocations_, slotsInUse_};
+}
+
+}  // namespace opcua::detail
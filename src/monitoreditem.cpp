@@ -25,14 +25,12 @@ static auto& getMonitoredItemContext(
 
 template <typename T>
 const NodeId& MonitoredItem<T>::nodeId() {
-    return getMonitoredItemContext(connection(), subscriptionId(), monitoredItemId())
-        .itemToMonitor.nodeId();
+    return getMonitoredItemContext(connection(), subscriptionId(), monitoredItemId()).nodeId;
 }
 
 template <typename T>
 AttributeId MonitoredItem<T>::attributeId() {
-    return getMonitoredItemContext(connection(), subscriptionId(), monitoredItemId())
-        .itemToMonitor.attributeId();
+    return getMonitoredItemContext(connection(), subscriptionId(), monitoredItemId()).attributeId;
 }
 
 // explicit template instantiations
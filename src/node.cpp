@@ -4,6 +4,7 @@
 #include "open62541pp/detail/open62541/client.h"
 #include "open62541pp/detail/open62541/server.h"
 #include "open62541pp/server.hpp"
+#include "open62541pp/services/detail/client_service.hpp"
 
 namespace opcua {
 
@@ -18,6 +19,7 @@ bool Node<Client>::exists() noexcept {
     request.nodesToReadSize = 1;
     request.nodesToRead = &item;
 
+    services::detail::flushCoalescedRequests(connection());
     const ReadResponse response = UA_Client_Service_read(connection().handle(), request);
     if (response->responseHeader.serviceResult != UA_STATUSCODE_GOOD ||
         response->resultsSize != 1) {
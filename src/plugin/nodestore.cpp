@@ -1,6 +1,9 @@
 #include "open62541pp/plugin/nodestore.hpp"
 
 #include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
 #include <optional>
 
 #include "open62541pp/detail/result_utils.hpp"
@@ -81,6 +84,128 @@ UA_ValueCallback ValueCallbackBase::create(bool ownsAdapter) {
     return native;
 }
 
+// Look up the session by id, it might be closed in the meantime.
+// Closed sessions and local reads of the server are not registered and have no session context.
+static std::optional<Session> findSession(UA_Server* server, const NodeId& sessionId) {
+    auto* wrapper = asWrapper(server);
+    auto* context = detail::getContext(server);
+    if (wrapper == nullptr || context == nullptr) {
+        return std::nullopt;
+    }
+    void* sessionContext = nullptr;
+    {
+        const std::scoped_lock lock{context->sessionRegistry.mutex};
+        const auto it = context->sessionRegistry.sessions.find(sessionId);
+        if (it != context->sessionRegistry.sessions.end()) {
+            sessionContext = it->second;
+        }
+    }
+    return Session(*wrapper, sessionId, sessionContext);
+}
+
+// Store the result of a data source read, the cache must be locked.
+static void storeDataSourceResult(
+    detail::DataSourceCache& cache, uint64_t generation, const DataValue& value, StatusCode status
+) noexcept {
+    if (cache.generation != generation) {
+        return;  // invalidated by a write in the meantime
+    }
+    try {
+        cache.value = value;  // deep copy, the data source might return non-owned data
+        cache.status = status;
+    } catch (...) {
+        cache.status = UA_STATUSCODE_BADOUTOFMEMORY;
+    }
+    cache.updated = std::chrono::steady_clock::now();
+    cache.hasResult = true;
+}
+
+// Read the data source in a worker thread and store the result in the node's cache.
+// Only the cache is shared with the worker, the data source is detached if the node is deleted.
+static void refreshDataSourceCache(
+    UA_Server* server,
+    const NodeId& sessionId,
+    const NodeId& id,
+    detail::DataSourceCache& cache,
+    uint64_t generation
+) noexcept {
+    DataValue value;
+    StatusCode status = UA_STATUSCODE_BADINTERNALERROR;
+    {
+        const std::scoped_lock sourceLock{cache.sourceMutex};
+        if (cache.source != nullptr) {
+            status = detail::tryInvoke([&] {
+                         auto session = findSession(server, sessionId);
+                         return session
+                             ? cache.source->read(session.value(), id, nullptr, value, true)
+                             : StatusCode{UA_STATUSCODE_BADINTERNALERROR};
+                     }
+            ).code();
+        }
+    }
+    const std::scoped_lock lock{cache.mutex};
+    cache.refreshing = false;
+    storeDataSourceResult(cache, generation, value, status);
+}
+
+static UA_StatusCode readCachedNative(
+    UA_Server* server,
+    detail::DataSourceWorkers& workers,
+    const UA_NodeId* sessionId,
+    void* sessionContext,
+    const UA_NodeId* nodeId,
+    detail::NodeContext& nodeContext,
+    UA_Boolean includeSourceTimeStamp,
+    UA_DataValue* value
+) noexcept {
+    auto& cache = *nodeContext.dataSourceCache;
+    std::unique_lock lock{cache.mutex};
+    if (!cache.hasResult) {
+        // cache miss (first read or invalidated by a write): read synchronously instead of failing
+        const uint64_t generation = cache.generation;
+        lock.unlock();
+        DataValue result;
+        StatusCode status = UA_STATUSCODE_BADINTERNALERROR;
+        auto session = getSession(server, sessionId, sessionContext);
+        if (nodeContext.dataSource != nullptr && session) {
+            status = detail::tryInvoke([&] {
+                         return nodeContext.dataSource->read(
+                             session.value(), asWrapper<NodeId>(*nodeId), nullptr, result, true
+                         );
+                     }
+            ).code();
+        }
+        lock.lock();
+        storeDataSourceResult(cache, generation, result, status);
+    } else if (const auto age = std::chrono::steady_clock::now() - cache.updated;
+               !cache.refreshing && age > workers.maxAge) {
+        try {
+            cache.refreshing = workers.pool.trySubmit(
+                [server,
+                 sessionIdCopy = asWrapper<NodeId>(*sessionId),
+                 id = asWrapper<NodeId>(*nodeId),
+                 cachePtr = nodeContext.dataSourceCache,
+                 generation = cache.generation] {
+                    refreshDataSourceCache(server, sessionIdCopy, id, *cachePtr, generation);
+                }
+            );
+        } catch (...) {  // NOLINT(bugprone-empty-catch), retry with the next read
+        }
+    }
+    if (!cache.hasResult) {
+        return UA_STATUSCODE_BADINTERNALERROR;  // result discarded, invalidated during the read
+    }
+    if (cache.status.isBad()) {
+        return cache.status;
+    }
+    const UA_StatusCode status = UA_DataValue_copy(cache.value.handle(), value);
+    if (status == UA_STATUSCODE_GOOD && !includeSourceTimeStamp) {
+        value->hasSourceTimestamp = false;
+        value->hasSourcePicoseconds = false;
+    }
+    return status;
+}
+
 static UA_StatusCode readNative(
     UA_Server* server,
     const UA_NodeId* sessionId,
@@ -92,6 +217,23 @@ static UA_StatusCode readNative(
     UA_DataValue* value
 ) noexcept {
     assert(nodeContext != nullptr && nodeId != nullptr && value != nullptr);
+    auto* wrapper = asWrapper(server);
+    auto* workers = wrapper != nullptr
+        ? detail::getContext(*wrapper).dataSourceWorkers.get()
+        : nullptr;
+    const auto& cache = static_cast<detail::NodeContext*>(nodeContext)->dataSourceCache;
+    if (workers != nullptr && cache != nullptr && range == nullptr && sessionId != nullptr) {
+        return readCachedNative(
+            server,
+            *workers,
+            sessionId,
+            sessionContext,
+            nodeId,
+            *static_cast<detail::NodeContext*>(nodeContext),
+            includeSourceTimeStamp,
+            value
+        );
+    }
     auto& source = static_cast<detail::NodeContext*>(nodeContext)->dataSource;
     auto session = getSession(server, sessionId, sessionContext);
     if (source != nullptr && session) {
@@ -121,6 +263,10 @@ static UA_StatusCode writeNative(
     assert(nodeContext != nullptr && nodeId != nullptr && value != nullptr);
     auto& source = static_cast<detail::NodeContext*>(nodeContext)->dataSource;
     auto session = getSession(server, sessionId, sessionContext);
+    // invalidate cached value of data source workers, discard results of running reads
+    if (const auto& cache = static_cast<detail::NodeContext*>(nodeContext)->dataSourceCache) {
+        cache->invalidate();
+    }
     if (source != nullptr && session) {
         return detail::tryInvoke([&] {
                    return source->write(
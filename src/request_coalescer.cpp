@@ -0,0 +1,341 @@
+#include "open62541pp/services/detail/request_coalescer.hpp"
+
+#include <algorithm>  // min
+#include <memory>
+#include <utility>  // move, swap
+#include <vector>
+
+#include "open62541pp/client.hpp"
+#include "open62541pp/config.hpp"
+#include "open62541pp/detail/client_context.hpp"
+#include "open62541pp/detail/open62541/common.h"
+#include "open62541pp/services/detail/client_service.hpp"
+#include "open62541pp/services/detail/request_handling.hpp"
+#include "open62541pp/span.hpp"
+#include "open62541pp/ua/types.hpp"
+
+namespace opcua::services::detail {
+
+namespace {
+
+struct Pending {
+    UA_ClientAsyncServiceCallback callback;
+    void* userdata;
+};
+
+// Requests with custom request headers (timeout hints, diagnostics, ...) are not coalesced
+bool hasDefaultRequestHeader(const UA_RequestHeader& header) noexcept {
+    return header.timeoutHint == 0 && header.returnDiagnostics == 0 &&
+        header.auditEntryId.length == 0 &&
+        header.additionalHeader.encoding == UA_EXTENSIONOBJECT_ENCODED_NOBODY;
+}
+
+struct ReadTraits {
+    using Request = UA_ReadRequest;
+    using Response = UA_ReadResponse;
+    using Item = ReadValueId;
+    static constexpr auto requestType = UA_TYPES_READREQUEST;
+    static constexpr auto responseType = UA_TYPES_READRESPONSE;
+    static constexpr auto resultType = UA_TYPES_DATAVALUE;
+
+    static Span<const UA_ReadValueId> items(const Request& request) noexcept {
+        return {request.nodesToRead, request.nodesToReadSize};
+    }
+
+    // only requests with the same parameters can be merged
+    static bool isCompatible(const Request& lhs, const Request& rhs) noexcept {
+        return lhs.maxAge == rhs.maxAge && lhs.timestampsToReturn == rhs.timestampsToReturn;
+    }
+
+    static Request makeRequest(const Request& params, Span<const Item> items) noexcept {
+        Request request{};
+        request.maxAge = params.maxAge;
+        request.timestampsToReturn = params.timestampsToReturn;
+        request.nodesToReadSize = items.size();
+        request.nodesToRead = getNativePointer(items);
+        return request;
+    }
+};
+
+struct WriteTraits {
+    using Request = UA_WriteRequest;
+    using Response = UA_WriteResponse;
+    using Item = WriteValue;
+    static constexpr auto requestType = UA_TYPES_WRITEREQUEST;
+    static constexpr auto responseType = UA_TYPES_WRITERESPONSE;
+    static constexpr auto resultType = UA_TYPES_STATUSCODE;
+
+    static Span<const UA_WriteValue> items(const Request& request) noexcept {
+        return {request.nodesToWrite, request.nodesToWriteSize};
+    }
+
+    static bool isCompatible(const Request& /* unused */, const Request& /* unused */) noexcept {
+        return true;
+    }
+
+    static Request makeRequest(const Request& /* unused */, Span<const Item> items) noexcept {
+        return makeWriteRequest(items);
+    }
+};
+
+#ifdef UA_ENABLE_METHODCALLS
+struct CallTraits {
+    using Request = UA_CallRequest;
+    using Response = UA_CallResponse;
+    using Item = CallMethodRequest;
+    static constexpr auto requestType = UA_TYPES_CALLREQUEST;
+    static constexpr auto responseType = UA_TYPES_CALLRESPONSE;
+    static constexpr auto resultType = UA_TYPES_CALLMETHODRESULT;
+
+    static Span<const UA_CallMethodRequest> items(const Request& request) noexcept {
+        return {request.methodsToCall, request.methodsToCallSize};
+    }
+
+    static bool isCompatible(const Request& /* unused */, const Request& /* unused */) noexcept {
+        return true;
+    }
+
+    static Request makeRequest(const Request& /* unused */, Span<const Item> items) noexcept {
+        Request request{};
+        request.methodsToCallSize = items.size();
+        request.methodsToCall = getNativePointer(items);
+        return request;
+    }
+};
+#endif
+
+template <typename Traits>
+class Batch {
+public:
+    using Request = typename Traits::Request;
+    using Response = typename Traits::Response;
+
+    size_t size() const noexcept {
+        return pending_.size();
+    }
+
+    bool isCompatible(const Request& request) const noexcept {
+        return pending_.empty() || Traits::isCompatible(params_, request);
+    }
+
+    void push(const Request& request, Pending pending) {
+        if (pending_.empty()) {
+            params_ = Traits::makeRequest(request, {});
+        }
+        pending_.reserve(pending_.size() + 1);
+        items_.push_back(asWrapper<typename Traits::Item>(Traits::items(request)[0]));
+        pending_.push_back(pending);  // won't throw
+    }
+
+    void flush(UA_Client* client) noexcept {
+        if (pending_.empty()) {
+            return;
+        }
+        // the pending callbacks are owned by the merged request until its response arrives
+        auto pending = std::make_unique<std::vector<Pending>>(std::exchange(pending_, {}));
+        const auto request = Traits::makeRequest(
+            params_, Span<const typename Traits::Item>{items_.data(), items_.size()}
+        );
+        const UA_StatusCode status = __UA_Client_AsyncService(
+            client,
+            &request,
+            &UA_TYPES[Traits::requestType],
+            callbackNative,
+            &UA_TYPES[Traits::responseType],
+            pending.get(),
+            nullptr
+        );
+        items_.clear();  // items are encoded, not needed anymore
+        if (status == UA_STATUSCODE_GOOD) {
+            pending.release();  // NOLINT(*-unused-return-value), owned by callbackNative
+        } else {
+            fail(client, *pending, status);
+        }
+    }
+
+    void cancel(UA_Client* client, UA_StatusCode code) noexcept {
+        fail(client, std::exchange(pending_, {}), code);
+        items_.clear();
+    }
+
+private:
+    static void fail(
+        UA_Client* client, const std::vector<Pending>& pending, UA_StatusCode code
+    ) noexcept {
+        for (const auto& item : pending) {
+            Response response{};
+            response.responseHeader.serviceResult = code;
+            item.callback(client, item.userdata, 0, &response);
+        }
+    }
+
+    // split the merged response into single-item responses and dispatch them
+    static void callbackNative(
+        UA_Client* client, void* userdata, uint32_t requestId, void* responsePtr
+    ) noexcept {
+        const std::unique_ptr<std::vector<Pending>> pending{
+            static_cast<std::vector<Pending>*>(userdata)
+        };
+        auto* response = static_cast<Response*>(responsePtr);
+        for (size_t i = 0; i < pending->size(); ++i) {
+            const auto& item = (*pending)[i];
+            if (response == nullptr) {
+                item.callback(client, item.userdata, requestId, nullptr);
+                continue;
+            }
+            Response single{};
+            if (UA_ResponseHeader_copy(&response->responseHeader, &single.responseHeader) !=
+                UA_STATUSCODE_GOOD) {
+                single.responseHeader.serviceResult = UA_STATUSCODE_BADOUTOFMEMORY;
+            } else if (i < response->resultsSize) {
+                // move result, the merged response is cleared by open62541 afterwards
+                single.results = static_cast<decltype(single.results)>(
+                    UA_new(&UA_TYPES[Traits::resultType])
+                );
+                if (single.results != nullptr) {
+                    std::swap(*single.results, response->results[i]);  // NOLINT
+                    single.resultsSize = 1;
+                }
+            }
+            item.callback(client, item.userdata, requestId, &single);
+            UA_clear(&single, &UA_TYPES[Traits::responseType]);
+        }
+    }
+
+    Request params_{};
+    std::vector<typename Traits::Item> items_;
+    std::vector<Pending> pending_;
+};
+
+// smallest non-zero limit, 0 if unlimited
+size_t minLimit(size_t lhs, size_t rhs) noexcept {
+    if (lhs == 0 || rhs == 0) {
+        return lhs + rhs;
+    }
+    return std::min(lhs, rhs);
+}
+
+template <typename Traits>
+bool pushTo(
+    Batch<Traits>& batch, UA_Client* client, const void* request, Pending pending, size_t maxItems
+) {
+    const auto& native = *static_cast<const typename Traits::Request*>(request);
+    if (Traits::items(native).size() != 1 || !hasDefaultRequestHeader(native.requestHeader)) {
+        return false;
+    }
+    if (!batch.isCompatible(native)) {
+        batch.flush(client);
+    }
+    batch.push(native, pending);
+    if (maxItems > 0 && batch.size() >= maxItems) {
+        batch.flush(client);
+    }
+    return true;
+}
+
+}  // namespace
+
+struct RequestCoalescer::Batches {
+    Batch<ReadTraits> read;
+    Batch<WriteTraits> write;
+#ifdef UA_ENABLE_METHODCALLS
+    Batch<CallTraits> call;
+#endif
+};
+
+RequestCoalescer::RequestCoalescer() = default;
+
+RequestCoalescer::~RequestCoalescer() {
+    cancel(nullptr, UA_STATUSCODE_BADSHUTDOWN);
+}
+
+bool RequestCoalescer::push(
+    UA_Client* client,
+    const UA_DataType& requestType,
+    const void* request,
+    UA_ClientAsyncServiceCallback callback,
+    void* userdata,
+    size_t limit
+) {
+    if (!enabled_) {
+        return false;
+    }
+    if (batches_ == nullptr) {
+        batches_ = std::make_unique<Batches>();
+    }
+    // keep the issue order, e.g. a buffered write must be sent before a read of the same node
+    if (bufferedType_ != nullptr && bufferedType_ != &requestType) {
+        flush(client);
+    }
+    const Pending pending{callback, userdata};
+    const size_t maxItems = minLimit(maxItems_, limit);
+    bool buffered = false;
+    if (&requestType == &UA_TYPES[ReadTraits::requestType]) {
+        buffered = pushTo(batches_->read, client, request, pending, maxItems);
+    } else if (&requestType == &UA_TYPES[WriteTraits::requestType]) {
+        buffered = pushTo(batches_->write, client, request, pending, maxItems);
+    }
+#ifdef UA_ENABLE_METHODCALLS
+    else if (&requestType == &UA_TYPES[CallTraits::requestType]) {
+        buffered = pushTo(batches_->call, client, request, pending, maxItems);
+    }
+#endif
+    if (!buffered) {
+        flush(client);  // the request is sent as usual and must not overtake buffered requests
+        return false;
+    }
+    bufferedType_ = &requestType;
+    return true;
+}
+
+void RequestCoalescer::flush(UA_Client* client) noexcept {
+    bufferedType_ = nullptr;
+    if (batches_ == nullptr) {
+        return;
+    }
+    batches_->read.flush(client);
+    batches_->write.flush(client);
+#ifdef UA_ENABLE_METHODCALLS
+    batches_->call.flush(client);
+#endif
+}
+
+void RequestCoalescer::cancel(UA_Client* client, UA_StatusCode code) noexcept {
+    bufferedType_ = nullptr;
+    if (batches_ == nullptr) {
+        return;
+    }
+    batches_->read.cancel(client, code);
+    batches_->write.cancel(client, code);
+#ifdef UA_ENABLE_METHODCALLS
+    batches_->call.cancel(client, code);
+#endif
+}
+
+bool coalesceRequest(
+    Client& client,
+    const UA_DataType& requestType,
+    const void* request,
+    UA_ClientAsyncServiceCallback callback,
+    void* userdata
+) {
+    auto& context = opcua::detail::getContext(client);
+    if (!context.coalescer.isEnabled()) {
+        return false;
+    }
+    // merged requests must not exceed the cached operation limits of the server
+    const auto& limits = context.operationLimits;
+    size_t limit = 0;
+    if (&requestType == &UA_TYPES[ReadTraits::requestType]) {
+        limit = limits.maxNodesPerRead.value_or(0);
+    } else if (&requestType == &UA_TYPES[WriteTraits::requestType]) {
+        limit = limits.maxNodesPerWrite.value_or(0);
+    }
+    return context.coalescer.push(client.handle(), requestType, request, callback, userdata, limit);
+}
+
+void flushCoalescedRequests(Client& client) noexcept {
+    opcua::detail::getContext(client).coalescer.flush(client.handle());
+}
+
+}  // namespace opcua::services::detail
@@ -1,7 +1,14 @@
 #include "open62541pp/server.hpp"
 
+#include <algorithm>  // max
+#include <atomic>
 #include <cassert>
+#include <chrono>
+#include <cstddef>  // ptrdiff_t
+#include <exception>
 #include <mutex>
+#include <string_view>
+#include <thread>
 #include <utility>  // move
 
 #include "open62541pp/datatype.hpp"
@@ -202,6 +209,39 @@ static void applySessionRegistry(UA_ServerConfig& config, detail::ServerContext&
     }
 }
 
+static void destructNode(
+    UA_Server* server,
+    const UA_NodeId* sessionId,
+    void* sessionContext,
+    const UA_NodeId* nodeId,
+    void* nodeContext
+) {
+    auto* context = detail::getContext(server);
+    if (context == nullptr) {
+        return;
+    }
+    // call user-defined function
+    if (context->nodeDestructorUser != nullptr) {
+        context->nodeDestructorUser(server, sessionId, sessionContext, nodeId, nodeContext);
+    }
+    // detach the data source from queued refreshes, it might be destroyed with the node
+    if (nodeId != nullptr && nodeContext != nullptr &&
+        context->nodeContexts.find(*nodeId) == nodeContext) {
+        auto& cache = static_cast<detail::NodeContext*>(nodeContext)->dataSourceCache;
+        if (cache != nullptr) {
+            cache->setSource(nullptr);
+        }
+    }
+}
+
+static void applyNodeLifecycle(UA_ServerConfig& config, detail::ServerContext& context) {
+    // Call only once per server, see applySessionRegistry
+    if (config.nodeLifecycle.destructor != &destructNode) {
+        context.nodeDestructorUser = config.nodeLifecycle.destructor;
+        config.nodeLifecycle.destructor = &destructNode;
+    }
+}
+
 static void updateLoggerStackPointer([[maybe_unused]] UA_ServerConfig& config) noexcept {
 #if UAPP_OPEN62541_VER_LE(1, 2)
     for (auto& layer : Span(config.networkLayers, config.networkLayersSize)) {
@@ -241,6 +281,7 @@ Server::Server(ServerConfig&& config)
 #endif
     updateLoggerStackPointer(this->config());
     setWrapperAsContextPointer(*this);
+    applyNodeLifecycle(this->config(), context());
 }
 
 Server::Server(UA_Server* native)
@@ -250,9 +291,18 @@ Server::Server(UA_Server* native)
         throw BadStatus(UA_STATUSCODE_BADOUTOFMEMORY);
     }
     setWrapperAsContextPointer(*this);
+    applyNodeLifecycle(config(), context());
 }
 
-Server::~Server() = default;
+Server::~Server() {
+    if (context_ != nullptr) {
+        // complete queued operations before the server is deleted
+        context_->dataSourceWorkers.reset();
+#if UAPP_HAS_ASYNC_OPERATIONS
+        context_->asyncOperationWorkers.reset();
+#endif
+    }
+}
 
 Server::Server(Server&& other) noexcept
     : context_{std::move(other.context_)},
@@ -507,6 +557,10 @@ static void setVariableNodeValueBackend(
     Server& server, const NodeId& id, detail::UniqueOrRawPtr<DataSourceBase>&& source
 ) {
     auto* nodeContext = detail::getContext(server).nodeContexts[id];
+    if (nodeContext->dataSourceCache != nullptr) {
+        // wait for running reads of the workers before the previous data source is destroyed
+        nodeContext->dataSourceCache->setSource(source.get());
+    }
     nodeContext->dataSource = std::move(source);
     throwIfBad(UA_Server_setNodeContext(server.handle(), id, nodeContext));
     throwIfBad(UA_Server_setVariableNode_dataSource(
@@ -524,6 +578,35 @@ void setVariableNodeValueBackend(
     setVariableNodeValueBackend(server, id, detail::UniqueOrRawPtr{std::move(source)});
 }
 
+void setDataSourceCaching(Server& server, const NodeId& id, bool enabled) {
+    auto* nodeContext = detail::getContext(server).nodeContexts[id];
+    auto& cache = nodeContext->dataSourceCache;
+    if (enabled && cache == nullptr) {
+        cache = std::make_shared<detail::DataSourceCache>();
+        cache->setSource(nodeContext->dataSource.get());
+    }
+    if (!enabled && cache != nullptr) {
+        cache->setSource(nullptr);  // queued refreshes keep the cache alive
+        cache.reset();
+    }
+}
+
+void enableDataSourceWorkers(Server& server, const DataSourceWorkerOptions& options) {
+    const size_t threads = options.threads > 0
+        ? options.threads
+        : std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    auto& workers = detail::getContext(server).dataSourceWorkers;
+    workers.reset();
+    workers.reset(new detail::DataSourceWorkers{  // NOLINT(*owning-memory), not movable
+        {threads, options.maxQueueSize},
+        options.maxAge,
+    });
+}
+
+void disableDataSourceWorkers(Server& server) {
+    detail::getContext(server).dataSourceWorkers.reset();
+}
+
 /* -------------------------------------- Async operations -------------------------------------- */
 
 #if UAPP_HAS_ASYNC_OPERATIONS
@@ -560,6 +643,128 @@ void runAsyncOperation(Server& server, const AsyncOperation& operation) {
         setAsyncOperationResult(server, response, operation.context);
     }
 }
+
+// No result was set, answer the call instead of stalling the client until its timeout
+static void failAsyncOperation(Server& server, const AsyncOperation& operation) noexcept {
+    if (operation.type == UA_ASYNCOPERATIONTYPE_CALL && operation.request != nullptr) {
+        UA_CallMethodResult result{};
+        result.statusCode = UA_STATUSCODE_BADINTERNALERROR;
+        setAsyncOperationResult(server, result, operation.context);
+    }
+}
+
+static void logAsyncOperationException(Server& server, std::string_view message) noexcept {
+    // NOLINTNEXTLINE
+    UA_LOG_ERROR(
+        detail::getLogger(server.config().handle()),
+        UA_LOGCATEGORY_SERVER,
+        "Exception in async operation worker: %.*s",
+        static_cast<int>(message.size()),
+        message.data()
+    );
+}
+
+static void runAsyncOperations(Server& server, detail::AsyncOperationWorkers& workers) {
+    while (const auto operation = getAsyncOperation(server)) {
+        --workers.queued;
+        const bool isCall = operation->type == UA_ASYNCOPERATIONTYPE_CALL &&
+            operation->request != nullptr;
+        // the server might free the operation once its result is set, copy the method id before
+        NodeId methodId;
+        ++workers.running;
+        const auto start = std::chrono::steady_clock::now();
+        try {
+            if (isCall) {
+                methodId = asWrapper<NodeId>(operation->request->callMethodRequest.methodId);
+            }
+            runAsyncOperation(server, operation.value());
+        } catch (const std::exception& e) {
+            failAsyncOperation(server, operation.value());
+            logAsyncOperationException(server, e.what());
+        } catch (...) {
+            failAsyncOperation(server, operation.value());
+            logAsyncOperationException(server, "unknown exception");
+        }
+        const auto duration = std::chrono::steady_clock::now() - start;
+        --workers.running;
+        if (isCall) {
+            std::scoped_lock lock{workers.mutexStatistics};
+            auto& statistics = workers.methods[methodId];
+            ++statistics.count;
+            statistics.totalDuration += duration;
+            statistics.maxDuration = std::max(statistics.maxDuration, duration);
+        }
+    }
+    // resync, operations removed from the queue by timeouts are never dequeued
+    workers.queued = 0;
+}
+
+static void submitAsyncOperationWorker(UA_Server* server, detail::AsyncOperationWorkers& workers) {
+    try {
+        // a full queue is fine, each queued worker processes all pending operations
+        workers.pool.trySubmit([server, &workers] {
+            auto* wrapper = asWrapper(server);
+            if (wrapper != nullptr) {
+                runAsyncOperations(*wrapper, workers);
+            }
+        });
+    } catch (...) {  // NOLINT(bugprone-empty-catch), operations are processed by the next worker
+    }
+}
+
+static void notifyAsyncOperationWorkers(UA_Server* server) noexcept {
+    auto* context = detail::getContext(server);
+    if (context == nullptr || context->asyncOperationWorkers == nullptr) {
+        return;
+    }
+    auto& workers = *context->asyncOperationWorkers;
+    ++workers.queued;
+    if (workers.notifyCallback != nullptr) {
+        workers.notifyCallback(server);
+    }
+    submitAsyncOperationWorker(server, workers);
+}
+
+void enableAsyncOperationWorkers(Server& server, size_t threads) {
+    disableAsyncOperationWorkers(server);
+    if (threads == 0) {
+        threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    auto& workers = detail::getContext(server).asyncOperationWorkers;
+    workers = std::make_unique<detail::AsyncOperationWorkers>(threads);
+    workers->notifyCallback = server.config()->asyncOperationNotifyCallback;
+    server.config()->asyncOperationNotifyCallback = notifyAsyncOperationWorkers;
+    submitAsyncOperationWorker(server.handle(), *workers);  // process already queued operations
+}
+
+void disableAsyncOperationWorkers(Server& server) {
+    auto& workers = detail::getContext(server).asyncOperationWorkers;
+    if (workers != nullptr) {
+        server.config()->asyncOperationNotifyCallback = workers->notifyCallback;
+        workers.reset();
+    }
+}
+
+AsyncOperationStatistics getAsyncOperationStatistics(Server& server) {
+    AsyncOperationStatistics result{};
+    auto* workers = detail::getContext(server).asyncOperationWorkers.get();
+    if (workers == nullptr) {
+        return result;
+    }
+    result.queued = static_cast<size_t>(std::max<ptrdiff_t>(workers->queued, 0));
+    result.running = workers->running;
+    std::scoped_lock lock{workers->mutexStatistics};
+    result.methods.reserve(workers->methods.size());
+    for (const auto& [methodId, statistics] : workers->methods) {
+        result.methods.push_back({
+            methodId,
+            statistics.count,
+            std::chrono::duration_cast<std::chrono::nanoseconds>(statistics.totalDuration),
+            std::chrono::duration_cast<std::chrono::nanoseconds>(statistics.maxDuration),
+        });
+    }
+    return result;
+}
 #endif
 
 }  // namespace opcua
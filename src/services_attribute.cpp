@@ -1,11 +1,20 @@
 #include "open62541pp/services/attribute.hpp"
 
+#include <algorithm>  // fill, min, transform
+#include <memory>
+#include <optional>
+#include <utility>  // move
+#include <vector>
+
 #include "open62541pp/client.hpp"
+#include "open62541pp/detail/client_context.hpp"
 #include "open62541pp/server.hpp"
+#include "open62541pp/ua/nodeids.hpp"
 
 namespace opcua::services {
 
 ReadResponse read(Client& connection, const ReadRequest& request) noexcept {
+    detail::flushCoalescedRequests(connection);
     return UA_Client_Service_read(connection.handle(), request);
 }
 
@@ -30,6 +39,7 @@ Result<DataValue> readAttribute<Client>(
 }
 
 WriteResponse write(Client& connection, const WriteRequest& request) noexcept {
+    detail::flushCoalescedRequests(connection);
     return UA_Client_Service_write(connection.handle(), request);
 }
 
@@ -50,4 +60,228 @@ StatusCode writeAttribute<Client>(
     return detail::getSingleStatus(write(connection, asWrapper<WriteRequest>(request)));
 }
 
+/* -------------------------------------- Batched functions ------------------------------------- */
+
+using OperationLimits = opcua::detail::ClientContext::OperationLimits;
+
+uint32_t detail::getOperationLimit(const Result<DataValue>& result) noexcept {
+    if (!result.hasValue() || !result->hasValue()) {
+        return 0;
+    }
+    const auto& var = result->value();
+    return var.isScalar() && var.isType<uint32_t>() ? var.scalar<uint32_t>() : 0;
+}
+
+static size_t getOperationLimit(
+    Client& connection, std::optional<uint32_t> OperationLimits::*limit, VariableId id
+) {
+    auto& cached = opcua::detail::getContext(connection).operationLimits.*limit;
+    if (!cached.has_value()) {
+        cached = detail::getOperationLimit(
+            readAttribute(connection, id, AttributeId::Value, TimestampsToReturn::Neither)
+        );
+    }
+    return *cached;
+}
+
+/// Send requests with `size` items in chunks of at most `limit` items (0 = no limit).
+/// A single chunk is sent synchronously. Multiple chunks are sent in parallel and the client is
+/// iterated until all responses are handled.
+template <typename Request, typename Response, typename MakeRequest, typename Handler>
+static void sendChunked(
+    Client& connection, size_t size, size_t limit, MakeRequest&& makeRequest, Handler&& handler
+) {
+    if (size == 0) {
+        return;
+    }
+    const size_t chunkSize = limit == 0 ? size : limit;
+    if (size <= chunkSize) {
+        const auto request = makeRequest(0, size);
+        auto response = detail::sendRequest<Request, Response>(
+            connection, asWrapper<Request>(request)
+        );
+        handler(0, size, response);
+        return;
+    }
+
+    // shared with the callbacks, which might outlive this function if an exception is thrown
+    struct State {
+        size_t pending{0};
+        bool cancelled{false};
+    };
+    auto state = std::make_shared<State>();
+    try {
+        for (size_t offset = 0; offset < size; offset += chunkSize) {
+            const size_t count = std::min(chunkSize, size - offset);
+            const auto request = makeRequest(offset, count);
+            ++state->pending;
+            detail::sendRequestAsync<Request, Response>(
+                connection,
+                asWrapper<Request>(request),
+                [state, &handler, offset, count](Response& response) {
+                    --state->pending;
+                    if (!state->cancelled) {
+                        handler(offset, count, response);
+                    }
+                }
+            );
+        }
+        while (state->pending > 0) {
+            connection.runIterate();
+        }
+    } catch (...) {
+        state->cancelled = true;
+        throw;
+    }
+}
+
+void detail::readValuesChunked(
+    Client& connection, Span<const NodeId> ids, const ReadChunkHandler& handler
+) {
+    std::vector<UA_ReadValueId> items(ids.size());
+    std::transform(ids.begin(), ids.end(), items.begin(), [](const NodeId& id) {
+        return detail::makeReadValueId(id, AttributeId::Value);
+    });
+    sendChunked<ReadRequest, ReadResponse>(
+        connection,
+        items.size(),
+        getOperationLimit(
+            connection,
+            &OperationLimits::maxNodesPerRead,
+            VariableId::Server_ServerCapabilities_OperationLimits_MaxNodesPerRead
+        ),
+        [&](size_t offset, size_t count) {
+            return detail::makeReadRequest(
+                TimestampsToReturn::Neither,
+                Span<const UA_ReadValueId>{items.data() + offset, count}  // NOLINT
+            );
+        },
+        handler
+    );
+}
+
+// Copy the status codes of a chunk `[offset, offset + count)` to the results
+static void copyChunkStatus(
+    const WriteResponse& response, size_t offset, size_t count, std::vector<StatusCode>& results
+) noexcept {
+    const auto& native = asNative(response);
+    const StatusCode serviceResult = native.responseHeader.serviceResult;
+    for (size_t i = 0; i < count; ++i) {
+        if (serviceResult.isBad()) {
+            results[offset + i] = serviceResult;
+        } else if (i < native.resultsSize) {
+            results[offset + i] = native.results[i];  // NOLINT
+        }
+    }
+}
+
+static size_t getMaxNodesPerWrite(Client& connection) {
+    return getOperationLimit(
+        connection,
+        &OperationLimits::maxNodesPerWrite,
+        VariableId::Server_ServerCapabilities_OperationLimits_MaxNodesPerWrite
+    );
+}
+
+std::vector<StatusCode> writeValues(
+    Client& connection, Span<const NodeId> ids, Span<const Variant> values
+) {
+    if (ids.size() != values.size()) {
+        throw BadStatus{UA_STATUSCODE_BADINVALIDARGUMENT};
+    }
+    const auto items = detail::makeWriteValues(ids, values);
+    std::vector<StatusCode> results(items.size(), UA_STATUSCODE_BADUNEXPECTEDERROR);
+    sendChunked<WriteRequest, WriteResponse>(
+        connection,
+        items.size(),
+        getMaxNodesPerWrite(connection),
+        [&](size_t offset, size_t count) {
+            return detail::makeWriteRequest(
+                Span<const UA_WriteValue>{items.data() + offset, count}  // NOLINT
+            );
+        },
+        [&](size_t offset, size_t count, WriteResponse& response) {
+            copyChunkStatus(response, offset, count, results);
+        }
+    );
+    return results;
+}
+
+void detail::writeValuesChunkedAsync(
+    Client& connection, const WriteRequest& request, WriteValuesHandler handler
+) {
+    struct State {
+        std::vector<StatusCode> results;
+        size_t pending;
+        WriteValuesHandler handler;
+
+        void complete() {
+            if (--pending == 0) {
+                handler(results);
+            }
+        }
+    };
+    const size_t size = request.nodesToWrite().size();
+    auto state = std::make_shared<State>(State{
+        std::vector<StatusCode>(size, UA_STATUSCODE_BADUNEXPECTEDERROR),
+        0,
+        std::move(handler),
+    });
+
+    // the chunks are encoded when sent, the items are only referenced until then
+    auto sendChunks = [&connection, state, size](const WriteRequest& items, size_t limit) {
+        const size_t chunkSize = limit == 0 ? size : limit;
+        state->pending = 1;  // released after all chunks are sent
+        for (size_t offset = 0; offset < size; offset += chunkSize) {
+            const size_t count = std::min(chunkSize, size - offset);
+            const auto chunk = detail::makeWriteRequest(
+                Span<const UA_WriteValue>{asNative(items).nodesToWrite + offset, count}  // NOLINT
+            );
+            ++state->pending;
+            const StatusCode status = detail::trySendRequestAsync<WriteRequest, WriteResponse>(
+                connection,
+                asWrapper<WriteRequest>(chunk),
+                [state, offset, count](WriteResponse& response) {
+                    copyChunkStatus(response, offset, count, state->results);
+                    state->complete();
+                }
+            );
+            if (status.isBad()) {
+                // the callback is never invoked, mark the items of the chunk bad
+                for (size_t i = 0; i < count; ++i) {
+                    state->results[offset + i] = status;
+                }
+                --state->pending;
+            }
+        }
+        state->complete();
+    };
+
+    const auto& cached = opcua::detail::getContext(connection).operationLimits.maxNodesPerWrite;
+    if (cached.has_value()) {
+        sendChunks(request, *cached);
+        return;
+    }
+    // the operation limit is unknown (first call per session), keep a copy of the request until
+    // the limit is read
+    const NodeId limitId{VariableId::Server_ServerCapabilities_OperationLimits_MaxNodesPerWrite};
+    auto item = detail::makeReadValueId(limitId, AttributeId::Value);
+    const auto limitRequest = detail::makeReadRequest(TimestampsToReturn::Neither, item);
+    const StatusCode status = detail::trySendRequestAsync<ReadRequest, ReadResponse>(
+        connection,
+        asWrapper<ReadRequest>(limitRequest),
+        [&connection, sendChunks, request = WriteRequest{request}](ReadResponse& response) {
+            const uint32_t limit = detail::getOperationLimit(
+                detail::wrapSingleResult<DataValue>(response)
+            );
+            opcua::detail::getContext(connection).operationLimits.maxNodesPerWrite = limit;
+            sendChunks(request, limit);
+        }
+    );
+    if (status.isBad()) {
+        std::fill(state->results.begin(), state->results.end(), status);
+        state->handler(state->results);
+    }
+}
+
 }  // namespace opcua::services
@@ -9,6 +9,7 @@
 namespace opcua::services {
 
 CallResponse call(Client& connection, const CallRequest& request) noexcept {
+    detail::flushCoalescedRequests(connection);
     return UA_Client_Service_call(connection.handle(), request);
 }
 
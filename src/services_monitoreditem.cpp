@@ -4,17 +4,37 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <memory>
+#include <utility>  // move, pair
+#include <vector>
 
 #include "open62541pp/client.hpp"
 #include "open62541pp/detail/client_context.hpp"
 #include "open62541pp/detail/exceptioncatcher.hpp"
 #include "open62541pp/detail/server_context.hpp"
 #include "open62541pp/server.hpp"
+#include "open62541pp/services/attribute.hpp"
+#include "open62541pp/ua/nodeids.hpp"
 
 namespace opcua::services {
 
 namespace detail {
 
+template <typename T>
+static auto makeMonitoredItemCallbacks(
+    T& connection,
+    DataChangeNotificationCallback&& dataChangeCallback,
+    EventNotificationCallback&& eventCallback,
+    DeleteMonitoredItemCallback&& deleteCallback
+) {
+    auto callbacks = std::make_shared<MonitoredItemCallbacks>();
+    callbacks->catcher = &opcua::detail::getExceptionCatcher(connection);
+    callbacks->dataChangeCallback = std::move(dataChangeCallback);
+    callbacks->eventCallback = std::move(eventCallback);
+    callbacks->deleteCallback = std::move(deleteCallback);
+    return callbacks;
+}
+
 template <typename T>
 static auto makeMonitoredItemContext(
     T& connection,
@@ -24,31 +44,40 @@ static auto makeMonitoredItemContext(
     DeleteMonitoredItemCallback deleteCallback
 ) {
     auto context = std::make_unique<MonitoredItemContext>();
-    context->catcher = &opcua::detail::getExceptionCatcher(connection);
-    context->itemToMonitor = itemToMonitor;
-    context->dataChangeCallback = std::move(dataChangeCallback);
-    context->eventCallback = std::move(eventCallback);
-    context->deleteCallback = std::move(deleteCallback);
+    context->attributeId = itemToMonitor.attributeId();
+    context->nodeId = itemToMonitor.nodeId();
+    context->callbacks = makeMonitoredItemCallbacks(
+        connection,
+        std::move(dataChangeCallback),
+        std::move(eventCallback),
+        std::move(deleteCallback)
+    );
     return context;
 }
 
 std::vector<std::unique_ptr<MonitoredItemContext>> makeMonitoredItemContexts(
     Client& connection,
     const CreateMonitoredItemsRequest& request,
-    // NOLINTBEGIN(performance-unnecessary-value-param)
     DataChangeNotificationCallback dataChangeCallback,
     EventNotificationCallback eventCallback,
     DeleteMonitoredItemCallback deleteCallback
-    // NOLINTEND(performance-unnecessary-value-param)
 ) {
-    // TODO: move first callback, then copy
+    // all items share the callbacks, the contexts only store their monitored node and attribute
     const auto items = request.itemsToCreate();
+    const std::shared_ptr<const MonitoredItemCallbacks> callbacks = makeMonitoredItemCallbacks(
+        connection,
+        std::move(dataChangeCallback),
+        std::move(eventCallback),
+        std::move(deleteCallback)
+    );
     std::vector<std::unique_ptr<MonitoredItemContext>> contexts(items.size());
-    std::transform(items.begin(), items.end(), contexts.begin(), [&](const auto& item) {
-        return makeMonitoredItemContext(
-            connection, item.itemToMonitor(), dataChangeCallback, eventCallback, deleteCallback
-        );
-    });
+    for (size_t i = 0; i < contexts.size(); ++i) {
+        const auto& itemToMonitor = items[i].itemToMonitor();
+        contexts[i] = std::make_unique<MonitoredItemContext>();
+        contexts[i]->attributeId = itemToMonitor.attributeId();
+        contexts[i]->nodeId = itemToMonitor.nodeId();
+        contexts[i]->callbacks = callbacks;
+    }
     return contexts;
 }
 
@@ -112,12 +141,23 @@ void storeMonitoredItemContexts(
     const CreateMonitoredItemsResponse& response,
     Span<std::unique_ptr<MonitoredItemContext>> contexts
 ) {
-    if (getServiceResult(response).isGood()) {
-        const auto results = response.results();
-        for (size_t i = 0; i < results.size(); ++i) {
-            storeMonitoredItemContext(connection, subscriptionId, results[i], contexts[i]);
+    if (getServiceResult(response).isBad()) {
+        return;
+    }
+    // insert all contexts in one batch, each shard of the map is locked only once
+    using SubMonId = opcua::detail::ClientContext::SubMonId;
+    const auto results = response.results();
+    std::vector<std::pair<SubMonId, std::unique_ptr<MonitoredItemContext>>> entries;
+    entries.reserve(results.size());
+    for (size_t i = 0; i < results.size(); ++i) {
+        if (results[i].statusCode().isGood()) {
+            contexts[i]->inserted = true;
+            entries.emplace_back(
+                SubMonId{subscriptionId, results[i].monitoredItemId()}, std::move(contexts[i])
+            );
         }
     }
+    opcua::detail::getContext(connection).monitoredItems.insertMany(std::move(entries));
 }
 
 }  // namespace detail
@@ -138,6 +178,7 @@ CreateMonitoredItemsResponse createMonitoredItemsDataChange(
     detail::convertMonitoredItemContexts(
         contexts, contextsPtr, dataChangeCallbacks, {}, deleteCallbacks
     );
+    detail::flushCoalescedRequests(connection);
     CreateMonitoredItemsResponse response = UA_Client_MonitoredItems_createDataChanges(
         connection.handle(),
         request,
@@ -149,6 +190,126 @@ CreateMonitoredItemsResponse createMonitoredItemsDataChange(
     return response;
 }
 
+static size_t getMaxMonitoredItemsPerCall(Client& connection) {
+    auto& cached = opcua::detail::getContext(connection).operationLimits.maxMonitoredItemsPerCall;
+    if (!cached.has_value()) {
+        cached = detail::getOperationLimit(readAttribute(
+            connection,
+            VariableId::Server_ServerCapabilities_OperationLimits_MaxMonitoredItemsPerCall,
+            AttributeId::Value,
+            TimestampsToReturn::Neither
+        ));
+    }
+    return *cached;
+}
+
+// Move the results of a chunk `[offset, offset + count)` to the results
+static void moveChunkResults(
+    CreateMonitoredItemsResponse& response,
+    size_t offset,
+    size_t count,
+    std::vector<MonitoredItemCreateResult>& results
+) noexcept {
+    const StatusCode serviceResult = detail::getServiceResult(response);
+    auto chunkResults = response.results();
+    for (size_t i = 0; i < count; ++i) {
+        if (serviceResult.isBad()) {
+            results[offset + i]->statusCode = serviceResult.get();
+        } else if (i < chunkResults.size()) {
+            results[offset + i] = std::move(chunkResults[i]);
+        }
+    }
+}
+
+std::vector<MonitoredItemCreateResult> createMonitoredItemsDataChange(
+    Client& connection,
+    IntegerId subscriptionId,
+    Span<const ReadValueId> itemsToMonitor,
+    MonitoringMode monitoringMode,
+    const MonitoringParametersEx& parameters,
+    // NOLINTBEGIN(performance-unnecessary-value-param)
+    DataChangeNotificationCallback dataChangeCallback,
+    DeleteMonitoredItemCallback deleteCallback
+    // NOLINTEND(performance-unnecessary-value-param)
+) {
+    std::vector<MonitoredItemCreateResult> results(itemsToMonitor.size());
+    for (auto& result : results) {
+        result->statusCode = UA_STATUSCODE_BADUNEXPECTEDERROR;
+    }
+    if (itemsToMonitor.empty()) {
+        return results;
+    }
+    std::vector<UA_MonitoredItemCreateRequest> items(itemsToMonitor.size());
+    std::transform(
+        itemsToMonitor.begin(),
+        itemsToMonitor.end(),
+        items.begin(),
+        [&](const ReadValueId& item) {
+            return detail::makeMonitoredItemCreateRequest(item, monitoringMode, parameters);
+        }
+    );
+    const auto makeRequest = [&](size_t offset, size_t count) {
+        return detail::makeCreateMonitoredItemsRequest(
+            subscriptionId,
+            parameters.timestamps,
+            Span<const UA_MonitoredItemCreateRequest>{items.data() + offset, count}  // NOLINT
+        );
+    };
+    const size_t limit = getMaxMonitoredItemsPerCall(connection);
+    const size_t chunkSize = limit == 0 ? items.size() : limit;
+
+#if UAPP_HAS_ASYNC_SUBSCRIPTIONS
+    if (items.size() > chunkSize) {
+        // send all chunks in parallel, the client is iterated until all responses are handled;
+        // shared with the callbacks, which might outlive this function if an exception is thrown
+        struct State {
+            size_t pending{0};
+            bool cancelled{false};
+        };
+        auto state = std::make_shared<State>();
+        try {
+            for (size_t offset = 0; offset < items.size(); offset += chunkSize) {
+                const size_t count = std::min(chunkSize, items.size() - offset);
+                const auto request = makeRequest(offset, count);
+                ++state->pending;
+                createMonitoredItemsDataChangeAsync(
+                    connection,
+                    asWrapper<CreateMonitoredItemsRequest>(request),
+                    dataChangeCallback,
+                    deleteCallback,
+                    [state, &results, offset, count](CreateMonitoredItemsResponse& response) {
+                        --state->pending;
+                        if (!state->cancelled) {
+                            moveChunkResults(response, offset, count, results);
+                        }
+                    }
+                );
+            }
+            while (state->pending > 0) {
+                connection.runIterate();
+            }
+        } catch (...) {
+            state->cancelled = true;
+            throw;
+        }
+        return results;
+    }
+#endif
+
+    for (size_t offset = 0; offset < items.size(); offset += chunkSize) {
+        const size_t count = std::min(chunkSize, items.size() - offset);
+        const auto request = makeRequest(offset, count);
+        auto response = createMonitoredItemsDataChange(
+            connection,
+            asWrapper<CreateMonitoredItemsRequest>(request),
+            dataChangeCallback,
+            deleteCallback
+        );
+        moveChunkResults(response, offset, count, results);
+    }
+    return results;
+}
+
 template <>
 MonitoredItemCreateResult createMonitoredItemDataChange<Client>(
     Client& connection,
@@ -212,6 +373,7 @@ CreateMonitoredItemsResponse createMonitoredItemsEvent(
     detail::convertMonitoredItemContexts(
         contexts, contextsPtr, {}, eventCallbacks, deleteCallbacks
     );
+    detail::flushCoalescedRequests(connection);
     CreateMonitoredItemsResponse response = UA_Client_MonitoredItems_createEvents(
         connection.handle(),
         request,
@@ -248,24 +410,28 @@ MonitoredItemCreateResult createMonitoredItemEvent(
 ModifyMonitoredItemsResponse modifyMonitoredItems(
     Client& connection, const ModifyMonitoredItemsRequest& request
 ) noexcept {
+    detail::flushCoalescedRequests(connection);
     return UA_Client_MonitoredItems_modify(connection.handle(), request);
 }
 
 SetMonitoringModeResponse setMonitoringMode(
     Client& connection, const SetMonitoringModeRequest& request
 ) noexcept {
+    detail::flushCoalescedRequests(connection);
     return UA_Client_MonitoredItems_setMonitoringMode(connection.handle(), request);
 }
 
 SetTriggeringResponse setTriggering(
     Client& connection, const SetTriggeringRequest& request
 ) noexcept {
+    detail::flushCoalescedRequests(connection);
     return UA_Client_MonitoredItems_setTriggering(connection.handle(), request);
 }
 
 DeleteMonitoredItemsResponse deleteMonitoredItems(
     Client& connection, const DeleteMonitoredItemsRequest& request
 ) noexcept {
+    detail::flushCoalescedRequests(connection);
     return UA_Client_MonitoredItems_delete(connection.handle(), request);
 }
 
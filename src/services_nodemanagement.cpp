@@ -14,22 +14,26 @@
 namespace opcua::services {
 
 AddNodesResponse addNodes(Client& connection, const AddNodesRequest& request) noexcept {
+    detail::flushCoalescedRequests(connection);
     return UA_Client_Service_addNodes(connection.handle(), request);
 }
 
 AddReferencesResponse addReferences(
     Client& connection, const AddReferencesRequest& request
 ) noexcept {
+    detail::flushCoalescedRequests(connection);
     return UA_Client_Service_addReferences(connection.handle(), request);
 }
 
 DeleteNodesResponse deleteNodes(Client& connection, const DeleteNodesRequest& request) noexcept {
+    detail::flushCoalescedRequests(connection);
     return UA_Client_Service_deleteNodes(connection.handle(), request);
 }
 
 DeleteReferencesResponse deleteReferences(
     Client& connection, const DeleteReferencesRequest& request
 ) noexcept {
+    detail::flushCoalescedRequests(connection);
     return UA_Client_Service_deleteReferences(connection.handle(), request);
 }
 
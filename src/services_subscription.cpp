@@ -8,6 +8,7 @@
 #include "open62541pp/detail/client_context.hpp"
 #include "open62541pp/detail/open62541/client.h"
 #include "open62541pp/detail/open62541/common.h"
+#include "open62541pp/exception.hpp"
 #include "open62541pp/services/detail/response_handling.hpp"
 #include "open62541pp/services/detail/subscription_context.hpp"
 #include "open62541pp/ua/types.hpp"
@@ -25,9 +26,20 @@ std::unique_ptr<SubscriptionContext> createSubscriptionContext(
     context->catcher = &opcua::detail::getContext(connection).exceptionCatcher;
     context->statusChangeCallback = std::move(statusChangeCallback);
     context->deleteCallback = std::move(deleteCallback);
+    context->pendingBatches = &opcua::detail::getContext(connection).pendingDataChangeBatches;
     return context;
 }
 
+void flushDataChangeBatches(Client& connection) noexcept {
+    auto& pending = opcua::detail::getContext(connection).pendingDataChangeBatches;
+    // pop one by one, callbacks might add new batches or delete subscriptions
+    while (!pending.empty()) {
+        auto* context = pending.back();
+        pending.pop_back();
+        context->flushDataChanges();
+    }
+}
+
 void storeSubscriptionContext(
     Client& connection, IntegerId subscriptionId, std::unique_ptr<SubscriptionContext>&& context
 ) {
@@ -45,6 +57,7 @@ CreateSubscriptionResponse createSubscription(
     auto context = detail::createSubscriptionContext(
         connection, std::move(statusChangeCallback), std::move(deleteCallback)
     );
+    detail::flushCoalescedRequests(connection);
     CreateSubscriptionResponse response = UA_Client_Subscriptions_create(
         connection.handle(),
         request,
@@ -77,18 +90,34 @@ CreateSubscriptionResponse createSubscription(
 ModifySubscriptionResponse modifySubscription(
     Client& connection, const ModifySubscriptionRequest& request
 ) noexcept {
+    detail::flushCoalescedRequests(connection);
     return UA_Client_Subscriptions_modify(connection.handle(), request);
 }
 
 SetPublishingModeResponse setPublishingMode(
     Client& connection, const SetPublishingModeRequest& request
 ) noexcept {
+    detail::flushCoalescedRequests(connection);
     return UA_Client_Subscriptions_setPublishingMode(connection.handle(), request);
 }
 
+void setDataChangeBatchCallback(
+    Client& connection, IntegerId subscriptionId, DataChangeBatchCallback callback
+) {
+    auto* context = opcua::detail::getContext(connection).subscriptions.find(subscriptionId);
+    if (context == nullptr || context->stale) {
+        throw BadStatus{UA_STATUSCODE_BADSUBSCRIPTIONIDINVALID};
+    }
+    // deliver collected data changes with the previous callback, e.g. received within
+    // synchronous service calls, the callback might be cleared
+    context->flushDataChangesNow();
+    context->dataChangeBatchCallback = std::move(callback);
+}
+
 DeleteSubscriptionsResponse deleteSubscriptions(
     Client& connection, const DeleteSubscriptionsRequest& request
 ) noexcept {
+    detail::flushCoalescedRequests(connection);
     return UA_Client_Subscriptions_delete(connection.handle(), request);
 }
 
@@ -1,15 +1,25 @@
 #include "open62541pp/services/view.hpp"
 
+#include <algorithm>  // max, min
 #include <cstddef>  // size_t
+#include <deque>
+#include <exception>  // current_exception, rethrow_exception
+#include <memory>
+#include <utility>  // move, pair
+#include <vector>
 
 #include "open62541pp/client.hpp"
+#include "open62541pp/detail/client_context.hpp"
 #include "open62541pp/server.hpp"
+#include "open62541pp/services/attribute.hpp"
 #include "open62541pp/services/detail/client_service.hpp"
 #include "open62541pp/types.hpp"
+#include "open62541pp/ua/nodeids.hpp"
 
 namespace opcua::services {
 
 BrowseResponse browse(Client& connection, const BrowseRequest& request) noexcept {
+    detail::flushCoalescedRequests(connection);
     return UA_Client_Service_browse(connection.handle(), request);
 }
 
@@ -30,6 +40,7 @@ BrowseResult browse<Client>(
 }
 
 BrowseNextResponse browseNext(Client& connection, const BrowseNextRequest& request) noexcept {
+    detail::flushCoalescedRequests(connection);
     return UA_Client_Service_browseNext(connection.handle(), request);
 }
 
@@ -54,6 +65,7 @@ BrowseResult browseNext<Client>(
 TranslateBrowsePathsToNodeIdsResponse translateBrowsePathsToNodeIds(
     Client& connection, const TranslateBrowsePathsToNodeIdsRequest& request
 ) noexcept {
+    detail::flushCoalescedRequests(connection);
     return UA_Client_Service_translateBrowsePathsToNodeIds(connection.handle(), request);
 }
 
@@ -78,13 +90,293 @@ BrowsePathResult translateBrowsePathToNodeIds<Client>(
 RegisterNodesResponse registerNodes(
     Client& connection, const RegisterNodesRequest& request
 ) noexcept {
+    detail::flushCoalescedRequests(connection);
     return UA_Client_Service_registerNodes(connection.handle(), request);
 }
 
 UnregisterNodesResponse unregisterNodes(
     Client& connection, const UnregisterNodesRequest& request
 ) noexcept {
+    detail::flushCoalescedRequests(connection);
     return UA_Client_Service_unregisterNodes(connection.handle(), request);
 }
 
+/* ------------------------------------- Pipelined browseAll ------------------------------------ */
+
+namespace {
+
+/// State of a pipelined browseAll operation, shared with the callbacks of pending requests.
+class BrowseAllOperation : public std::enable_shared_from_this<BrowseAllOperation> {
+public:
+    BrowseAllOperation(
+        Client& connection,
+        Span<const BrowseDescription> bds,
+        const BrowseAllOptions& options,
+        BrowseAllCallback callback,
+        detail::BrowseAllHandler handler
+    )
+        : connection_{connection},
+          bds_(bds.begin(), bds.end()),
+          options_{options},
+          callback_{std::move(callback)},
+          handler_{std::move(handler)},
+          results_(bds.size(), UA_STATUSCODE_BADUNEXPECTEDERROR) {
+        for (size_t i = 0; i < bds_.size(); ++i) {
+            nodes_.push_back(i);
+        }
+    }
+
+    void start(size_t maxNodesPerRequest) {
+        chunkSize_ = maxNodesPerRequest == 0 ? bds_.size() : maxNodesPerRequest;
+        pump();
+    }
+
+    /// Stop sending requests, nodes not completed yet get the status `code`.
+    /// The handler is invoked once the responses of all requests in flight are received.
+    void cancel(StatusCode code) {
+        cancelled_ = true;
+        for (const size_t index : nodes_) {
+            results_[index] = code;
+        }
+        for (const auto& [index, continuationPoint] : continuationPoints_) {
+            results_[index] = code;
+        }
+        nodes_.clear();
+        continuationPoints_.clear();
+        pump();
+    }
+
+private:
+    // index of the node and its continuation point
+    using ContinuationPoint = std::pair<size_t, ByteString>;
+
+    void pump() {
+        const size_t maxInFlight = std::max<size_t>(1, options_.maxRequestsInFlight);
+        while (inFlight_ < maxInFlight) {
+            // prefer BrowseNext requests to release continuation points in the server
+            if (!continuationPoints_.empty()) {
+                sendBrowseNext();
+            } else if (!nodes_.empty()) {
+                sendBrowse();
+            } else {
+                break;
+            }
+        }
+        if (!completed_ && inFlight_ == 0 && continuationPoints_.empty() && nodes_.empty()) {
+            completed_ = true;
+            handler_(results_);
+        }
+    }
+
+    void sendBrowse() {
+        std::vector<size_t> indices;
+        std::vector<UA_BrowseDescription> items;
+        while (!nodes_.empty() && indices.size() < chunkSize_) {
+            indices.push_back(nodes_.front());
+            items.push_back(*bds_[nodes_.front()].handle());  // shallow copy
+            nodes_.pop_front();
+        }
+        UA_BrowseRequest request{};
+        request.requestedMaxReferencesPerNode = options_.maxReferencesPerNode;
+        request.nodesToBrowseSize = items.size();
+        request.nodesToBrowse = items.data();
+        ++inFlight_;
+        const StatusCode status = detail::trySendRequestAsync<BrowseRequest, BrowseResponse>(
+            connection_,
+            asWrapper<BrowseRequest>(request),
+            [self = shared_from_this(), indices](BrowseResponse& response) {
+                self->handleResponse(indices, asNative(response), false);
+            }
+        );
+        if (status.isBad()) {
+            --inFlight_;
+            setResults(indices, status);
+        }
+    }
+
+    void sendBrowseNext() {
+        const size_t count = std::min(chunkSize_, continuationPoints_.size());
+        std::vector<ContinuationPoint> chunk(
+            std::make_move_iterator(continuationPoints_.begin()),
+            std::make_move_iterator(continuationPoints_.begin() + count)
+        );
+        continuationPoints_.erase(continuationPoints_.begin(), continuationPoints_.begin() + count);
+        std::vector<size_t> indices;
+        std::vector<UA_ByteString> items;
+        for (auto& [index, continuationPoint] : chunk) {
+            indices.push_back(index);
+            items.push_back(*continuationPoint.handle());  // shallow copy
+        }
+        UA_BrowseNextRequest request{};
+        request.releaseContinuationPoints = false;
+        request.continuationPointsSize = items.size();
+        request.continuationPoints = items.data();
+        ++inFlight_;
+        const StatusCode status =
+            detail::trySendRequestAsync<BrowseNextRequest, BrowseNextResponse>(
+                connection_,
+                asWrapper<BrowseNextRequest>(request),
+                [self = shared_from_this(), indices](BrowseNextResponse& response) {
+                    self->handleResponse(indices, asNative(response), true);
+                }
+            );
+        if (status.isBad()) {
+            --inFlight_;
+            heldContinuationPoints_ -= indices.size();  // abandoned, not retried anymore
+            setResults(indices, status);
+        }
+    }
+
+    void setResults(const std::vector<size_t>& indices, StatusCode status) {
+        for (const size_t index : indices) {
+            results_[index] = status;
+        }
+    }
+
+    template <typename Response>
+    void handleResponse(const std::vector<size_t>& indices, Response& response, bool next) {
+        --inFlight_;
+        if (next) {
+            heldContinuationPoints_ -= indices.size();  // consumed by the request
+        }
+        if (cancelled_) {
+            setResults(indices, UA_STATUSCODE_BADREQUESTCANCELLEDBYCLIENT);
+            pump();
+            return;
+        }
+        const StatusCode serviceResult = response.responseHeader.serviceResult;
+        size_t i = 0;
+        try {
+            for (; i < indices.size(); ++i) {
+                if (serviceResult.isBad()) {
+                    results_[indices[i]] = serviceResult;
+                } else if (i < response.resultsSize) {
+                    auto& result = asWrapper<BrowseResult>(response.results[i]);  // NOLINT
+                    handleResult(indices[i], result);
+                }
+            }
+        } catch (...) {
+            // exceptions of the callback cancel the operation and are rethrown by runIterate
+            for (; i < indices.size(); ++i) {
+                results_[indices[i]] = UA_STATUSCODE_BADREQUESTCANCELLEDBYCLIENT;
+            }
+            const auto exception = std::current_exception();
+            cancel(UA_STATUSCODE_BADREQUESTCANCELLEDBYCLIENT);
+            std::rethrow_exception(exception);
+        }
+        pump();
+    }
+
+    void handleResult(size_t index, BrowseResult& result) {
+        const StatusCode status = result.statusCode();
+        auto refs = result.references();
+        if (status == UA_STATUSCODE_BADNOCONTINUATIONPOINTS && refs.empty() &&
+            heldContinuationPoints_ > 0) {
+            nodes_.push_back(index);  // retry once continuation points are released
+            return;
+        }
+        if (!refs.empty() && callback_) {
+            callback_(index, refs);
+        }
+        if (status.isGood() && !result.continuationPoint().empty()) {
+            continuationPoints_.emplace_back(index, result.continuationPoint());
+            ++heldContinuationPoints_;
+            return;
+        }
+        results_[index] = status;
+    }
+
+    Client& connection_;
+    std::vector<BrowseDescription> bds_;
+    BrowseAllOptions options_;
+    BrowseAllCallback callback_;
+    detail::BrowseAllHandler handler_;
+    std::vector<StatusCode> results_;
+    std::deque<size_t> nodes_;  // indices of nodes to browse
+    std::deque<ContinuationPoint> continuationPoints_;  // to browse next
+    size_t heldContinuationPoints_{0};  // allocated in the server
+    size_t chunkSize_{1};
+    size_t inFlight_{0};
+    bool cancelled_{false};  // no more requests are sent
+    bool completed_{false};  // handler invoked
+};
+
+}  // namespace
+
+void detail::browseAllPipelinedAsync(
+    Client& connection,
+    Span<const BrowseDescription> bds,
+    const BrowseAllOptions& options,
+    BrowseAllCallback callback,
+    BrowseAllHandler handler
+) {
+    auto operation = std::make_shared<BrowseAllOperation>(
+        connection, bds, options, std::move(callback), std::move(handler)
+    );
+    if (options.maxNodesPerRequest > 0) {
+        operation->start(options.maxNodesPerRequest);
+        return;
+    }
+    const auto& cached = opcua::detail::getContext(connection).operationLimits.maxNodesPerBrowse;
+    if (cached.has_value()) {
+        operation->start(*cached);
+        return;
+    }
+    const NodeId limitId{VariableId::Server_ServerCapabilities_OperationLimits_MaxNodesPerBrowse};
+    auto item = detail::makeReadValueId(limitId, AttributeId::Value);
+    const auto limitRequest = detail::makeReadRequest(TimestampsToReturn::Neither, item);
+    const StatusCode status = detail::trySendRequestAsync<ReadRequest, ReadResponse>(
+        connection,
+        asWrapper<ReadRequest>(limitRequest),
+        [&connection, operation](ReadResponse& response) {
+            const uint32_t limit = detail::getOperationLimit(
+                detail::wrapSingleResult<DataValue>(response)
+            );
+            opcua::detail::getContext(connection).operationLimits.maxNodesPerBrowse = limit;
+            operation->start(limit);
+        }
+    );
+    if (status.isBad()) {
+        operation->cancel(status);
+    }
+}
+
+std::vector<StatusCode> browseAll(
+    Client& connection,
+    Span<const BrowseDescription> bds,
+    const BrowseAllCallback& callback,
+    const BrowseAllOptions& options
+) {
+    // shared with the callbacks, which might outlive this function if an exception is thrown
+    struct State {
+        std::vector<StatusCode> results;
+        bool done{false};
+        bool cancelled{false};
+    };
+    auto state = std::make_shared<State>();
+    try {
+        detail::browseAllPipelinedAsync(
+            connection,
+            bds,
+            options,
+            [state, &callback](size_t index, Span<ReferenceDescription> refs) {
+                if (!state->cancelled && callback) {
+                    callback(index, refs);
+                }
+            },
+            [state](std::vector<StatusCode>& results) {
+                state->results = std::move(results);
+                state->done = true;
+            }
+        );
+        while (!state->done) {
+            connection.runIterate();
+        }
+    } catch (...) {
+        state->cancelled = true;
+        throw;
+    }
+    return std::move(state->results);
+}
+
 }  // namespace opcua::services
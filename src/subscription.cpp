@@ -2,6 +2,8 @@
 
 #ifdef UA_ENABLE_SUBSCRIPTIONS
 
+#include <algorithm>  // sort
+
 #include "open62541pp/client.hpp"
 #include "open62541pp/detail/client_context.hpp"
 #include "open62541pp/detail/server_context.hpp"
@@ -27,15 +29,22 @@ Subscription<Server>::Subscription(
 
 template <typename T>
 std::vector<MonitoredItem<T>> Subscription<T>::monitoredItems() {
-    std::vector<MonitoredItem<T>> result;
+    std::vector<IntegerId> monIds;
     auto& monitoredItems = opcua::detail::getContext(connection()).monitoredItems;
     monitoredItems.eraseStale();
     monitoredItems.iterate([&](const auto& pair) {
         const auto [subId, monId] = pair.first;
         if (subId == subscriptionId()) {
-            result.emplace_back(connection(), subId, monId);
+            monIds.push_back(monId);
         }
     });
+    // hash map iteration order is unspecified, keep results sorted by id
+    std::sort(monIds.begin(), monIds.end());
+    std::vector<MonitoredItem<T>> result;
+    result.reserve(monIds.size());
+    for (const auto monId : monIds) {
+        result.emplace_back(connection(), subscriptionId(), monId);
+    }
     return result;
 }
 
@@ -0,0 +1,64 @@
+#include "open62541pp/detail/threadpool.hpp"
+
+#include <algorithm>  // max
+#include <utility>  // move
+
+namespace opcua::detail {
+
+ThreadPool::ThreadPool(size_t threads, size_t maxQueueSize)
+    : maxQueueSize_{std::max<size_t>(maxQueueSize, 1)} {
+    threads = std::max<size_t>(threads, 1);
+    threads_.reserve(threads);
+    for (size_t i = 0; i < threads; ++i) {
+        threads_.emplace_back([this] { work(); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::scoped_lock lock{mutex_};
+        stopped_ = true;
+    }
+    cv_.notify_all();
+    for (auto& thread : threads_) {
+        thread.join();
+    }
+}
+
+bool ThreadPool::trySubmit(Task&& task) {
+    {
+        std::scoped_lock lock{mutex_};
+        if (stopped_ || queue_.size() >= maxQueueSize_) {
+            return false;
+        }
+        queue_.push_back(std::move(task));
+    }
+    cv_.notify_one();
+    return true;
+}
+
+size_t ThreadPool::queueSize() const {
+    std::scoped_lock lock{mutex_};
+    return queue_.size();
+}
+
+void ThreadPool::work() {
+    while (true) {
+        Task task;
+        {
+            std::unique_lock lock{mutex_};
+            cv_.wait(lock, [this] { return stopped_ || !queue_.empty(); });
+            if (queue_.empty()) {
+                return;  // stopped and drained
+            }
+            task = std::move(queue_.front());
+            queue_.pop_front();
+        }
+        try {
+            task();
+        } catch (...) {  // NOLINT(bugprone-empty-catch)
+        }
+    }
+}
+
+}  // namespace opcua::detail
@@ -0,0 +1,140 @@
+#include <chrono>
+#include <future>
+#include <sstream>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "open62541pp/addressspacecrawler.hpp"
+#include "open62541pp/exception.hpp"
+#include "open62541pp/services/nodemanagement.hpp"
+
+#include "helper/server_client_setup.hpp"
+
+using namespace opcua;
+
+TEST_CASE("AddressSpaceCrawler") {
+    ServerClientSetup setup;
+    setup.client.connect(setup.endpointUrl);
+    auto& server = setup.server;
+    auto& client = setup.client;
+
+    // Root
+    // ├── A
+    // │   ├── V2
+    // │   └── V3 (string identifier)
+    // ├── V1
+    // └── V2 (second reference)
+    const NodeId root{1, 100};
+    const NodeId a{1, 101};
+    const NodeId v1{1, 102};
+    const NodeId v2{1, 103};
+    const NodeId v3{1, "V3"};
+    const NodeId hasComponent{ReferenceTypeId::HasComponent};
+    const NodeId objectType{ObjectTypeId::BaseObjectType};
+    const NodeId variableType{VariableTypeId::BaseDataVariableType};
+    const NodeId objectsFolder{ObjectId::ObjectsFolder};
+    REQUIRE(services::addObject(server, objectsFolder, root, "Root", {}, objectType, hasComponent));
+    REQUIRE(services::addObject(server, root, a, "A", {}, objectType, hasComponent));
+    REQUIRE(services::addVariable(server, root, v1, "V1", {}, variableType, hasComponent));
+    REQUIRE(services::addVariable(server, a, v2, "V2", {}, variableType, hasComponent));
+    REQUIRE(services::addVariable(server, a, v3, "V3", {}, variableType, hasComponent));
+    REQUIRE(services::addReference(server, root, v2, hasComponent, true).isGood());
+
+    std::vector<CrawledNode> nodes;
+    const auto collect = [&](CrawledNode& node) { nodes.push_back(std::move(node)); };
+    const auto find = [&](const NodeId& id) -> const CrawledNode* {
+        for (const auto& node : nodes) {
+            if (node.nodeId == id) {
+                return &node;
+            }
+        }
+        return nullptr;
+    };
+
+    SECTION("Crawl") {
+        AddressSpaceCrawler crawler{client};
+        const auto statistics = crawler.crawl({root}, collect);
+        CHECK(statistics.discoveredNodes == 5);
+        CHECK(statistics.reportedNodes == 5);
+        CHECK(statistics.browseErrors == 0);
+        REQUIRE(nodes.size() == 5);
+
+        CHECK(nodes[0].nodeId == root);
+        CHECK(nodes[0].index == 0);
+        CHECK(nodes[0].parentIndex == CrawledNode::npos);
+        CHECK(nodes[0].depth == 0);
+
+        // visited once, with the shortest path
+        REQUIRE(find(v2) != nullptr);
+        CHECK(find(v2)->depth == 1);
+        CHECK(find(v2)->parentIndex == 0);
+        REQUIRE(find(v3) != nullptr);
+        CHECK(find(v3)->depth == 2);
+        CHECK(find(v3)->parentIndex == find(a)->index);
+        CHECK(find(v3)->referenceTypeId == hasComponent);
+        CHECK(find(v3)->nodeClass == NodeClass::Variable);
+        CHECK(find(v3)->browseName == QualifiedName{1, "V3"});
+    }
+
+    SECTION("Crawl async") {
+        AddressSpaceCrawler crawler{client};
+        auto future = crawler.crawlAsync({root}, collect, useFuture);
+        while (future.wait_for(std::chrono::seconds{0}) != std::future_status::ready) {
+            client.runIterate();
+        }
+        CHECK(future.get().discoveredNodes == 5);
+        CHECK(nodes.size() == 5);
+    }
+
+    SECTION("Crawl deferred") {
+        AddressSpaceCrawler crawler{client};
+        auto deferred = crawler.crawlAsync({root}, collect, useDeferred);  // temporary start nodes
+        auto future = deferred(useFuture);
+        while (future.wait_for(std::chrono::seconds{0}) != std::future_status::ready) {
+            client.runIterate();
+        }
+        CHECK(future.get().discoveredNodes == 5);
+        CHECK(nodes.size() == 5);
+    }
+
+    SECTION("Filter node classes") {
+        AddressSpaceCrawlerOptions options;
+        options.nodeClassMask = NodeClass::Variable;
+        AddressSpaceCrawler crawler{client, options};
+        const auto statistics = crawler.crawl({root}, collect);
+        CHECK(statistics.discoveredNodes == 5);
+        CHECK(statistics.reportedNodes == 4);  // start node and variables
+        CHECK(find(a) == nullptr);
+        CHECK(find(v3) != nullptr);
+    }
+
+    SECTION("Depth limit") {
+        AddressSpaceCrawlerOptions options;
+        options.maxDepth = 1;
+        AddressSpaceCrawler crawler{client, options};
+        const auto statistics = crawler.crawl({root}, collect);
+        CHECK(statistics.discoveredNodes == 4);
+        CHECK(find(v3) == nullptr);
+    }
+
+    SECTION("Snapshot") {
+        std::stringstream stream;
+        AddressSpaceSnapshotWriter writer{stream};
+        AddressSpaceCrawler crawler{client};
+        crawler.crawl({root}, writer);
+
+        readAddressSpaceSnapshot(stream, collect);
+        REQUIRE(nodes.size() == 5);
+        CHECK(nodes[0].nodeId == root);
+        CHECK(nodes[0].parentIndex == CrawledNode::npos);
+        REQUIRE(find(v3) != nullptr);
+        CHECK(find(v3)->parentIndex == find(a)->index);
+        CHECK(find(v3)->referenceTypeId == hasComponent);
+        CHECK(find(v3)->nodeClass == NodeClass::Variable);
+        CHECK(find(v3)->browseName == QualifiedName{1, "V3"});
+
+        std::stringstream invalid{"invalid"};
+        CHECK_THROWS_AS(readAddressSpaceSnapshot(invalid, collect), BadStatus);
+    }
+}
@@ -0,0 +1,78 @@
+#include <cstring>  // strcmp
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "open62541pp/arena.hpp"
+#include "open62541pp/config.hpp"
+#include "open62541pp/detail/open62541/common.h"
+#include "open62541pp/types.hpp"
+
+using namespace opcua;
+
+#if UAPP_HAS_ARENA
+
+TEST_CASE("ArenaScope") {
+    SECTION("Allocate wrapper types") {
+        ArenaScope arena;
+        CHECK(arena.bytesAllocated() == 0);
+        {
+            const String str{"Objects.Device.Sensors.Temperature"};
+            CHECK(arena.owns(str.handle()->data));
+            const Variant var{std::vector<double>(100, 11.11)};
+            CHECK(arena.owns(var.data()));
+            CHECK(Variant{var}.to<std::vector<double>>().size() == 100);
+        }
+        CHECK(arena.bytesAllocated() > 0);
+        CHECK(arena.bytesReserved() >= arena.bytesAllocated());
+    }
+
+    SECTION("Free memory allocated before the scope") {
+        String str{"Temperature"};
+        {
+            ArenaScope arena;
+            CHECK_FALSE(arena.owns(str.handle()->data));
+            str = String{"Pressure"};  // frees previous string with the default allocator
+            CHECK(arena.owns(str.handle()->data));
+            str = String{};
+        }
+    }
+
+    SECTION("Calloc") {
+        ArenaScope arena;
+        auto* ptr = static_cast<int*>(UA_calloc(100, sizeof(int)));
+        REQUIRE(ptr != nullptr);
+        CHECK(arena.owns(ptr));
+        for (size_t i = 0; i < 100; ++i) {
+            CHECK(ptr[i] == 0);  // NOLINT
+        }
+        UA_free(ptr);
+    }
+
+    SECTION("Realloc") {
+        ArenaScope arena{64};
+        auto* ptr = static_cast<char*>(UA_malloc(5));
+        std::memcpy(ptr, "abcd", 5);
+        ptr = static_cast<char*>(UA_realloc(ptr, 10000));  // exceeds first block
+        REQUIRE(ptr != nullptr);
+        CHECK(arena.owns(ptr));
+        CHECK(std::strcmp(ptr, "abcd") == 0);
+        UA_free(ptr);
+    }
+
+    SECTION("Nested scopes") {
+        ArenaScope outer;
+        const String str1{"outer"};
+        {
+            ArenaScope inner;
+            const String str2{"inner"};
+            CHECK(outer.owns(str1.handle()->data));
+            CHECK_FALSE(inner.owns(str1.handle()->data));
+            CHECK(inner.owns(str2.handle()->data));
+        }
+        const String str3{"outer"};
+        CHECK(outer.owns(str3.handle()->data));
+    }
+}
+
+#endif
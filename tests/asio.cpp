@@ -0,0 +1,81 @@
+#include <chrono>
+#include <utility>  // move
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "open62541pp/asio.hpp"
+#include "open62541pp/services/attribute_highlevel.hpp"
+#include "open62541pp/ua/nodeids.hpp"
+
+#include "helper/server_client_setup.hpp"
+
+// compiled against standalone Asio or Boost.Asio by a separate target, see tests/CMakeLists.txt
+// the target is compiled with C++20 if supported to test the `use_awaitable` token
+#ifdef UAPP_ASIO_BOOST
+namespace asio = boost::asio;
+#endif
+
+using namespace opcua;
+
+TEST_CASE("Asio (AsioClientRunner)") {
+    ServerClientSetup setup;
+    setup.client.connect(setup.endpointUrl);
+    auto& client = setup.client;
+
+    asio::io_context context;
+    AsioClientRunner runner{client, context.get_executor()};
+    CHECK_FALSE(runner.isRunning());
+    runner.start();
+    CHECK(runner.isRunning());
+
+    const NodeId id{VariableId::Server_ServerStatus_State};
+    Result<Variant> result;  // empty variant until completion
+
+    SECTION("Callback completion handler") {
+        services::readValueAsync(client, id, [&](Result<Variant>& value) {
+            result = std::move(value);
+            runner.stop();
+        });
+    }
+
+#if UAPP_ASIO_VERSION >= 102200  // 1.22.0
+    SECTION("Deferred completion token") {
+        auto operation = services::readValueAsync(client, id, asio::deferred);
+        std::move(operation)(asio::bind_executor(context, [&](Result<Variant> value) {
+            result = std::move(value);
+            runner.stop();
+        }));
+    }
+
+    SECTION("Promise completion token") {
+        auto promise = services::readValueAsync(client, id, asio::experimental::use_promise);
+        const auto handler = asio::bind_executor(context, [&](Result<Variant> value) {
+            result = std::move(value);
+            runner.stop();
+        });
+#if UAPP_ASIO_VERSION >= 102400  // 1.24.0, promises are callable with a completion token
+        promise(handler);
+#else
+        promise.async_wait(handler);
+#endif
+    }
+#endif
+
+#if defined(UAPP_ASIO_HAS_CO_AWAIT)
+    SECTION("Awaitable completion token") {
+        asio::co_spawn(
+            context,
+            [&]() -> asio::awaitable<void> {
+                result = co_await services::readValueAsync(client, id, asio::use_awaitable);
+                runner.stop();
+            },
+            asio::detached
+        );
+    }
+#endif
+
+    context.run_for(std::chrono::seconds{5});  // returns if the runner was stopped
+    CHECK_FALSE(runner.isRunning());
+    REQUIRE(result.hasValue());
+    CHECK(result.value().isScalar());  // handler was invoked
+}
@@ -5,6 +5,7 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include "open62541pp/async.hpp"
+#include "open62541pp/config.hpp"
 
 using namespace opcua;
 
@@ -1,14 +1,21 @@
 #include <chrono>
+#include <future>
+#include <set>
 #include <string_view>
 #include <thread>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
 
 #include "open62541pp/client.hpp"
 #include "open62541pp/config.hpp"
+#include "open62541pp/detail/client_context.hpp"
 #include "open62541pp/detail/open62541/client.h"
 #include "open62541pp/plugin/accesscontrol_default.hpp"
 #include "open62541pp/server.hpp"
+#include "open62541pp/services/attribute.hpp"
+#include "open62541pp/services/nodemanagement.hpp"  // addVariable
+#include "open62541pp/ua/nodeids.hpp"
 
 #include "helper/server_runner.hpp"
 
@@ -274,6 +281,130 @@ TEST_CASE("Client subscription inactivity callback") {
 #endif
 }
 
+TEST_CASE("Client request coalescing") {
+    Server server;
+    ServerRunner serverRunner{server};
+    Client client;
+    client.connect(localServerUrl);
+
+    const auto wait = [&](auto& future) {
+        while (future.wait_for(std::chrono::seconds{0}) != std::future_status::ready) {
+            client.runIterate();
+        }
+        return future.get();
+    };
+
+    // 0: single merged request per service, 1: no merge
+    for (const size_t maxItems : {size_t{0}, size_t{1}}) {
+        CAPTURE(maxItems);
+        client.setRequestCoalescing(true, maxItems);
+
+        auto futureBrowseName = services::readAttributeAsync(
+            client,
+            ObjectId::Server,
+            AttributeId::BrowseName,
+            TimestampsToReturn::Neither,
+            useFuture
+        );
+        auto futureDisplayName = services::readAttributeAsync(
+            client,
+            ObjectId::Server,
+            AttributeId::DisplayName,
+            TimestampsToReturn::Neither,
+            useFuture
+        );
+        auto futureUnknown = services::readAttributeAsync(
+            client, NodeId{1, 9999}, AttributeId::Value, TimestampsToReturn::Neither, useFuture
+        );
+        // different parameters, sent in a separate request
+        auto futureTimestamps = services::readAttributeAsync(
+            client, ObjectId::Server, AttributeId::BrowseName, TimestampsToReturn::Both, useFuture
+        );
+        auto futureWrite = services::writeAttributeAsync(
+            client, NodeId{1, 9999}, AttributeId::Value, DataValue{Variant{1}}, useFuture
+        );
+
+        CHECK(
+            wait(futureBrowseName).value().value().scalar<QualifiedName>() ==
+            QualifiedName(0, "Server")
+        );
+        CHECK(
+            wait(futureDisplayName).value().value().scalar<LocalizedText>().text() == "Server"
+        );
+        CHECK(wait(futureUnknown).code() == UA_STATUSCODE_BADNODEIDUNKNOWN);
+        CHECK(wait(futureTimestamps).value().hasServerTimestamp());
+        CHECK(wait(futureWrite) == UA_STATUSCODE_BADNODEIDUNKNOWN);
+
+        // the server echoes the request handle of each request it receives,
+        // requests merged into a single request share the same handle
+        {
+            const std::vector<ReadValueId> items{
+                ReadValueId{ObjectId::Server, AttributeId::BrowseName},
+                ReadValueId{ObjectId::Server, AttributeId::DisplayName},
+                ReadValueId{ObjectId::Server, AttributeId::NodeClass},
+            };
+            std::vector<std::future<ReadResponse>> futures;
+            for (const auto& item : items) {
+                futures.push_back(services::readAsync(
+                    client,
+                    Span<const ReadValueId>{&item, 1},
+                    TimestampsToReturn::Neither,
+                    useFuture
+                ));
+            }
+            std::set<IntegerId> requestHandles;
+            for (auto& future : futures) {
+                const auto response = wait(future);
+                CHECK(response.results().size() == 1);
+                CHECK(response.results()[0].status().isGood());
+                requestHandles.insert(response.responseHeader().requestHandle());
+            }
+            CHECK(requestHandles.size() == (maxItems == 0 ? 1 : 3));
+        }
+    }
+
+    SECTION("Issue order") {
+        client.setRequestCoalescing(true);
+        // sync request, sent after buffered requests
+        const NodeId id{1, 1000};
+        REQUIRE(services::addVariable(
+            client,
+            {0, UA_NS0ID_OBJECTSFOLDER},
+            id,
+            "Variable",
+            VariableAttributes{}.setAccessLevel(
+                AccessLevel::CurrentRead | AccessLevel::CurrentWrite
+            ),
+            VariableTypeId::BaseDataVariableType,
+            ReferenceTypeId::HasComponent
+        ));
+        // the buffered write must be sent before the read of the same node
+        auto futureWrite = services::writeValueAsync(client, id, Variant{11}, useFuture);
+        auto futureRead = services::readValueAsync(client, id, useFuture);
+        CHECK(wait(futureWrite).isGood());
+        CHECK(wait(futureRead).value().scalar<int>() == 11);
+    }
+
+    SECTION("Limited by cached operation limits") {
+        client.setRequestCoalescing(true);  // no limit
+        detail::getContext(client).operationLimits.maxNodesPerRead = 2;
+        std::vector<std::future<ReadResponse>> futures;
+        const ReadValueId item{ObjectId::Server, AttributeId::BrowseName};
+        for (int i = 0; i < 3; ++i) {
+            futures.push_back(services::readAsync(
+                client, Span<const ReadValueId>{&item, 1}, TimestampsToReturn::Neither, useFuture
+            ));
+        }
+        std::set<IntegerId> requestHandles;
+        for (auto& future : futures) {
+            requestHandles.insert(wait(future).responseHeader().requestHandle());
+        }
+        CHECK(requestHandles.size() == 2);
+    }
+
+    client.setRequestCoalescing(false);
+}
+
 TEST_CASE("Client methods") {
     Server server;
     ServerRunner serverRunner{server};
@@ -1,7 +1,10 @@
+#include <array>
+
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_all.hpp>
 
 #include "open62541pp/client.hpp"
+#include "open62541pp/detail/handlerslab.hpp"
 #include "open62541pp/detail/open62541/common.h"
 #include "open62541pp/server.hpp"
 #include "open62541pp/services/detail/client_service.hpp"
@@ -63,6 +66,52 @@ TEST_CASE("AsyncServiceAdapter") {
     }
 }
 
+TEST_CASE("AsyncServiceAdapter with HandlerSlab") {
+    using Response = int;
+    using Adapter = services::detail::AsyncServiceAdapter<Response>;
+
+    detail::ExceptionCatcher catcher;
+    detail::HandlerSlab slab;
+    int calls = 0;
+
+    const auto invoke = [&](auto&& handler) {
+        auto callbackAndContext = Adapter::makeCallbackAndContext(catcher, &slab, handler);
+        Response response = 5;
+        callbackAndContext.callback(nullptr, callbackAndContext.context.release(), 0, &response);
+    };
+
+    SECTION("Recycle slots") {
+        for (int i = 0; i < 1000; ++i) {
+            invoke([&](Response) { ++calls; });
+        }
+        CHECK(calls == 1000);
+        const auto statistics = slab.statistics();
+        CHECK(statistics.chunkAllocations == 1);
+        CHECK(statistics.heapAllocations == 0);
+        CHECK(statistics.slotsInUse == 0);
+    }
+
+    SECTION("Fallback to heap for large handlers") {
+        std::array<char, detail::HandlerSlab::slotSize> large{};
+        invoke([&, large](Response) { calls += large[0] + 1; });
+        CHECK(calls == 1);
+        const auto statistics = slab.statistics();
+        CHECK(statistics.chunkAllocations == 0);
+        CHECK(statistics.heapAllocations == 1);
+        CHECK(statistics.slotsInUse == 0);
+    }
+
+    SECTION("Release slot if context is discarded") {
+        {
+            auto callbackAndContext = Adapter::makeCallbackAndContext(
+                catcher, &slab, [](Response) {}
+            );
+            CHECK(slab.statistics().slotsInUse == 1);
+        }
+        CHECK(slab.statistics().slotsInUse == 0);
+    }
+}
+
 TEST_CASE("sendRequest") {
     Client client;
 
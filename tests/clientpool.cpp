@@ -0,0 +1,122 @@
+#include <chrono>
+#include <stdexcept>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "open62541pp/clientpool.hpp"
+#include "open62541pp/config.hpp"
+#include "open62541pp/server.hpp"
+#include "open62541pp/services/attribute_highlevel.hpp"
+#include "open62541pp/services/monitoreditem.hpp"
+#include "open62541pp/services/subscription.hpp"
+
+#include "helper/server_runner.hpp"
+
+using namespace opcua;
+
+TEST_CASE("ClientPool") {
+    CHECK_THROWS_AS(ClientPool{0}, std::invalid_argument);
+
+    Server server;
+    ServerRunner serverRunner{server};
+    const NodeId id{VariableId::Server_ServerStatus_CurrentTime};
+
+    SECTION("Config factory") {
+        size_t configs = 0;
+        ClientPool pool{3, [&] {
+                            ++configs;
+                            ClientConfig config;
+                            config.setTimeout(1234);
+                            return config;
+                        }};
+        CHECK(configs == 3);
+        CHECK(pool.size() == 3);
+        CHECK(pool.at(2).config()->timeout == 1234);
+        CHECK_THROWS_AS(pool.at(3), std::out_of_range);
+    }
+
+    SECTION("Round robin") {
+        ClientPool pool{3};
+        CHECK(pool.connectedCount() == 0);
+        pool.connect("opc.tcp://localhost:4840");
+        CHECK(pool.connectedCount() == 3);
+
+        Client* first = &pool.next();
+        Client* second = &pool.next();
+        Client* third = &pool.next();
+        CHECK(first != second);
+        CHECK(second != third);
+        CHECK(third != first);
+        CHECK(&pool.next() == first);
+
+        // skip disconnected members
+        pool.at(1).disconnect();
+        for (int i = 0; i < 6; ++i) {
+            CHECK(&pool.next() != &pool.at(1));
+        }
+    }
+
+    SECTION("Least outstanding requests") {
+        ClientPool pool{2, {}, LoadBalancing::LeastOutstandingRequests};
+        pool.connect("opc.tcp://localhost:4840");
+
+        Client& busy = pool.next();
+        bool done = false;
+        services::readValueAsync(busy, id, [&](Result<Variant>&) { done = true; });
+        CHECK(&pool.next() != &busy);
+        CHECK(&pool.next() != &busy);
+
+        while (!done) {
+            pool.runIterate(10);
+        }
+        CHECK(busy.handlerStatistics().slotsInUse == 0);
+    }
+
+    SECTION("Reconnect dead members") {
+        ClientPool pool{2};
+        pool.setReconnectInterval(std::chrono::milliseconds{0});
+        pool.connect("opc.tcp://localhost:4840");
+        pool.at(0).disconnect();
+        CHECK(pool.connectedCount() == 1);
+
+        size_t connectedCallbacks = 0;
+        pool.at(0).onConnected([&] { ++connectedCallbacks; });
+        for (int i = 0; i < 1000 && pool.connectedCount() < 2; ++i) {
+            pool.runIterate(1);  // no new attempts while the handshake is in progress
+        }
+        CHECK(pool.connectedCount() == 2);
+        CHECK(connectedCallbacks == 1);
+
+        // no reconnect after disconnect of the pool
+        pool.disconnect();
+        for (int i = 0; i < 10; ++i) {
+            pool.runIterate(10);
+        }
+        CHECK(pool.connectedCount() == 0);
+    }
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+    SECTION("Spread monitored items") {
+        ClientPool pool{2};
+        pool.connect("opc.tcp://localhost:4840");
+
+        const auto createMonitoredItem = [&](Client& client) {
+            const auto subId = services::createSubscription(client, {}, true, {}, {})
+                                   .subscriptionId();
+            const auto result = services::createMonitoredItemDataChange(
+                client, subId, {id, AttributeId::Value}, MonitoringMode::Reporting, {}, {}, {}
+            );
+            REQUIRE(result.statusCode().isGood());
+        };
+
+        Client& first = pool.nextForMonitoredItems();
+        createMonitoredItem(first);
+        Client& second = pool.nextForMonitoredItems();
+        CHECK(&second != &first);
+        createMonitoredItem(second);
+        createMonitoredItem(second);
+        CHECK(&pool.nextForMonitoredItems() == &first);
+        CHECK(&pool.nextForMonitoredItems() == &first);
+    }
+#endif
+}
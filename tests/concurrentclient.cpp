@@ -0,0 +1,120 @@
+#include <future>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "open62541pp/concurrentclient.hpp"
+#include "open62541pp/detail/mpscqueue.hpp"
+#include "open62541pp/server.hpp"
+#include "open62541pp/services/attribute_highlevel.hpp"
+
+#include "helper/server_runner.hpp"
+
+using namespace opcua;
+
+TEST_CASE("MpscQueue") {
+    detail::MpscQueue<int> queue;
+    CHECK(queue.empty());
+    CHECK_FALSE(queue.pop().has_value());
+
+    SECTION("Single producer") {
+        queue.push(1);
+        queue.push(2);
+        CHECK_FALSE(queue.empty());
+        CHECK(queue.pop() == 1);
+        CHECK(queue.pop() == 2);
+        CHECK(queue.empty());
+    }
+
+    SECTION("Multiple producers") {
+        constexpr int producers = 4;
+        constexpr int itemsPerProducer = 10000;
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; ++p) {
+            threads.emplace_back([&queue, p] {
+                for (int i = 0; i < itemsPerProducer; ++i) {
+                    queue.push(p * itemsPerProducer + i);
+                }
+            });
+        }
+        std::vector<int> lastItem(producers, -1);
+        int count = 0;
+        while (count < producers * itemsPerProducer) {
+            if (const auto item = queue.pop()) {
+                // items of a single producer are popped in order
+                const int producer = *item / itemsPerProducer;
+                CHECK(*item > lastItem[producer]);
+                lastItem[producer] = *item;
+                ++count;
+            }
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        CHECK(queue.empty());
+    }
+}
+
+TEST_CASE("ConcurrentClient") {
+    Server server;
+    ServerRunner serverRunner{server};
+    ConcurrentClient client;
+    client.post([](Client& c) { c.connect("opc.tcp://localhost:4840"); });
+
+    const NodeId id{VariableId::Server_ServerStatus_State};
+
+    SECTION("execute") {
+        auto future = client.execute([&](Client& c) { return services::readValue(c, id); });
+        CHECK(future.get().hasValue());
+    }
+
+    SECTION("execute on I/O thread") {
+        auto future = client.execute([&](Client&) { return client.isIoThread(); });
+        CHECK(future.get().value() == true);
+        CHECK_FALSE(client.isIoThread());
+    }
+
+    SECTION("execute with exception") {
+        auto future = client.execute(
+            [](Client&) -> int { throw BadStatus{UA_STATUSCODE_BADUNEXPECTEDERROR}; }, useFuture
+        );
+        CHECK(future.get().code() == UA_STATUSCODE_BADUNEXPECTEDERROR);
+    }
+
+    SECTION("post with non-standard exception") {
+        client.post([](Client&) { throw 1; });  // NOLINT(hicpp-exception-baseclass)
+        // the exception is logged, the I/O thread keeps running
+        auto future = client.execute([&](Client& c) { return services::readValue(c, id); });
+        CHECK(future.get().hasValue());
+    }
+
+    SECTION("executeAsync from multiple threads") {
+        constexpr int threadCount = 8;
+        constexpr int requestsPerThread = 50;
+        std::vector<std::future<int>> results;
+        for (int t = 0; t < threadCount; ++t) {
+            results.push_back(std::async(std::launch::async, [&] {
+                std::vector<std::future<Result<Variant>>> futures;
+                for (int i = 0; i < requestsPerThread; ++i) {
+                    futures.push_back(client.executeAsync<Result<Variant>>(
+                        [&](Client& c, auto&& handler) {
+                            services::readValueAsync(
+                                c, id, std::forward<decltype(handler)>(handler)
+                            );
+                        },
+                        useFuture
+                    ));
+                }
+                int good = 0;
+                for (auto& future : futures) {
+                    good += future.get().hasValue() ? 1 : 0;
+                }
+                return good;
+            }));
+        }
+        for (auto& result : results) {
+            CHECK(result.get() == requestsPerThread);
+        }
+    }
+}
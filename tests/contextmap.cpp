@@ -0,0 +1,161 @@
+#include <cstdint>
+#include <memory>
+#include <utility>  // pair
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "open62541pp/detail/contextmap.hpp"
+#include "open62541pp/detail/server_context.hpp"  // NodeIdHash
+#include "open62541pp/types.hpp"
+
+using namespace opcua;
+using opcua::detail::ContextMap;
+
+struct StaleableContext {
+    bool stale{false};
+    int value{0};
+};
+
+TEST_CASE("ContextMap") {
+    ContextMap<uint32_t, StaleableContext> map;
+    CHECK(map.size() == 0);
+    CHECK(map.find(1) == nullptr);
+
+    SECTION("Insert, find and erase") {
+        auto* item = map.insert(
+            1, std::make_unique<StaleableContext>(StaleableContext{false, 11})
+        );
+        CHECK(map.size() == 1);
+        CHECK(map.contains(1));
+        CHECK(map.find(1) == item);
+        CHECK(map.find(1)->value == 11);
+
+        // assign to existing key
+        auto* other = map.insert(
+            1, std::make_unique<StaleableContext>(StaleableContext{false, 22})
+        );
+        CHECK(map.size() == 1);
+        CHECK(map.find(1) == other);
+        CHECK(map.find(1)->value == 22);
+
+        CHECK(map.erase(1) == 1);
+        CHECK(map.erase(1) == 0);
+        CHECK_FALSE(map.contains(1));
+    }
+
+    SECTION("Access or insert") {
+        auto* item = map[1];
+        REQUIRE(item != nullptr);
+        item->value = 11;
+        CHECK(map[1] == item);
+        CHECK(map[1]->value == 11);
+        CHECK(map.size() == 1);
+    }
+
+    SECTION("Many elements") {
+        for (uint32_t i = 0; i < 10000; ++i) {
+            map[i]->value = static_cast<int>(i);
+        }
+        CHECK(map.size() == 10000);
+        for (uint32_t i = 0; i < 10000; i += 2) {
+            CHECK(map.erase(i) == 1);
+        }
+        CHECK(map.size() == 5000);
+        for (uint32_t i = 0; i < 10000; ++i) {
+            const auto* item = map.find(i);
+            if (i % 2 == 0) {
+                CHECK(item == nullptr);
+            } else {
+                REQUIRE(item != nullptr);
+                CHECK(item->value == static_cast<int>(i));
+            }
+        }
+        size_t count = 0;
+        map.iterate([&](const auto& pair) {
+            CHECK(pair.first % 2 == 1);
+            CHECK(pair.second->value == static_cast<int>(pair.first));
+            ++count;
+        });
+        CHECK(count == 5000);
+    }
+
+    SECTION("Insert many") {
+        std::vector<std::pair<uint32_t, std::unique_ptr<StaleableContext>>> entries;
+        for (uint32_t i = 0; i < 1000; ++i) {
+            entries.emplace_back(
+                i, std::make_unique<StaleableContext>(StaleableContext{false, static_cast<int>(i)})
+            );
+        }
+        map.insert(1, std::make_unique<StaleableContext>());  // assigned
+        map.insertMany(std::move(entries));
+        CHECK(map.size() == 1000);
+        for (uint32_t i = 0; i < 1000; ++i) {
+            REQUIRE(map.find(i) != nullptr);
+            CHECK(map.find(i)->value == static_cast<int>(i));
+        }
+    }
+
+    SECTION("Stale elements") {
+        for (uint32_t i = 0; i < 100; ++i) {
+            map[i]->stale = (i % 2 == 0);
+        }
+        CHECK(map.eraseStale() == 50);
+        CHECK(map.size() == 50);
+        CHECK_FALSE(map.contains(0));
+        CHECK(map.contains(1));
+    }
+
+    SECTION("Stale elements are removed deferred on insertion") {
+        for (uint32_t i = 0; i < 100000; ++i) {
+            map[i]->stale = true;
+        }
+        CHECK(map.size() == 0);  // stale elements are not counted
+        const size_t remaining = map.eraseStale();
+        CHECK(remaining > 0);
+        CHECK(remaining < 100000);  // most were removed on insertion
+    }
+
+    SECTION("Stale elements are ignored until removed") {
+        map[1]->value = 11;
+        map[2]->value = 22;
+        map[1]->stale = true;
+        CHECK(map.size() == 1);
+        CHECK(map.find(1) == nullptr);
+        CHECK_FALSE(map.contains(1));
+        size_t count = 0;
+        map.iterate([&](const auto& pair) {
+            CHECK(pair.first == 2);
+            ++count;
+        });
+        CHECK(count == 1);
+        // replaced on access
+        CHECK(map[1]->value == 0);
+        CHECK_FALSE(map[1]->stale);
+        CHECK(map.size() == 2);
+    }
+}
+
+TEST_CASE("ContextMap with pair keys") {
+    ContextMap<std::pair<uint32_t, uint32_t>, StaleableContext> map;
+    map.insert({1, 2}, std::make_unique<StaleableContext>());
+    CHECK(map.contains({1, 2}));
+    CHECK_FALSE(map.contains({2, 1}));
+    CHECK(map.erase({1, 2}) == 1);
+}
+
+TEST_CASE("ContextMap with NodeId keys") {
+    ContextMap<NodeId, StaleableContext, detail::NodeIdHash> map;
+    const NodeId id{1, "Objects.Device.Sensors.Temperature"};
+    auto* item = map[id];
+    CHECK(map.find(id) == item);
+    CHECK(map.find(NodeId{1, "Objects.Device.Sensors.Temperature"}) == item);
+    CHECK(map.find(NodeId{1, "Objects.Device.Sensors.Pressure"}) == nullptr);
+
+    // heterogeneous lookup with native NodeId (no copy)
+    const UA_NodeId native = UA_NODEID_STRING(
+        1, const_cast<char*>("Objects.Device.Sensors.Temperature")  // NOLINT
+    );
+    CHECK(map.contains(native));
+    CHECK(map.find(native) == item);
+}
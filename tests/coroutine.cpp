@@ -0,0 +1,122 @@
+#include <functional>  // invoke
+#include <memory>
+#include <string>
+#include <utility>  // forward
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "open62541pp/async.hpp"
+#include "open62541pp/config.hpp"
+#include "open62541pp/services/attribute_highlevel.hpp"
+#include "open62541pp/ua/nodeids.hpp"
+
+#include "helper/server_client_setup.hpp"
+
+// compiled as C++20 by a separate test target, see tests/CMakeLists.txt
+#if !UAPP_HAS_COROUTINES
+#error "Coroutine tests require C++20 coroutine support"
+#endif
+
+using namespace opcua;
+
+template <typename T, typename CompletionToken>
+static auto asyncTest(T result, CompletionToken&& token) {
+    return asyncInitiate<T>(
+        [result](auto&& handler) mutable {
+            std::invoke(std::forward<decltype(handler)>(handler), result);
+        },
+        std::forward<CompletionToken>(token)
+    );
+}
+
+template <typename CompletionToken>
+static auto asyncTestDelayed(
+    std::function<void()>& complete, int result, CompletionToken&& token
+) {
+    return asyncInitiate<int>(
+        [&complete, result](auto&& handler) mutable {
+            complete = [h = std::make_shared<std::decay_t<decltype(handler)>>(
+                            std::forward<decltype(handler)>(handler)
+                        ),
+                        result]() mutable { (*h)(result); };
+        },
+        std::forward<CompletionToken>(token)
+    );
+}
+
+static Task<int> awaitTest(std::function<void()>& complete) {
+    const int immediate = co_await asyncTest(1, useAwaitable);
+    const int delayed = co_await asyncTestDelayed(complete, 2, useAwaitable);
+    co_return immediate + delayed;
+}
+
+static Task<int> awaitNestedTest(std::function<void()>& complete) {
+    co_return 10 * co_await awaitTest(complete);
+}
+
+TEST_CASE("Async (awaitable completion token)") {
+    std::function<void()> complete;
+
+    SECTION("Resume on completion") {
+        auto task = awaitTest(complete);
+        CHECK_FALSE(task.done());
+        task.start();
+        CHECK_FALSE(task.done());
+        REQUIRE(complete);
+        complete();
+        CHECK(task.done());
+        CHECK(task.result() == 3);
+    }
+
+    SECTION("Nested tasks") {
+        auto task = awaitNestedTest(complete);
+        task.start();
+        complete();
+        CHECK(task.done());
+        CHECK(task.result() == 30);
+    }
+
+    SECTION("Destroy task with pending operation") {
+        {
+            auto task = awaitTest(complete);
+            task.start();
+        }
+        REQUIRE(complete);
+        complete();  // the destroyed coroutine must not be resumed
+    }
+
+    SECTION("Exception if operation is not initiated") {
+        auto task = []() -> Task<> {
+            co_await asyncInitiate<int>([](auto&& /* handler is dropped */) {}, useAwaitable);
+        }();
+        task.start();
+        CHECK(task.done());
+        CHECK_THROWS_AS(task.result(), BadStatus);
+    }
+}
+
+static Task<std::vector<std::string>> readNamespacesTask(Client& client) {
+    auto namespaces = co_await services::readValueAsync(
+        client, VariableId::Server_NamespaceArray, useAwaitable
+    );
+    auto browseName = co_await services::readBrowseNameAsync(
+        client, ObjectId::Server, useAwaitable
+    );
+    std::vector<std::string> result = namespaces.value().to<std::vector<std::string>>();
+    result.push_back(std::string{browseName.value().name()});
+    co_return result;
+}
+
+TEST_CASE("Async (awaitable client services)") {
+    ServerClientSetup setup;
+    setup.client.connect(setup.endpointUrl);
+
+    auto task = readNamespacesTask(setup.client);
+    task.start();
+    CHECK(runIterateUntil(setup.client, [&] { return task.done(); }));
+    const auto result = task.result();
+    REQUIRE(result.size() == 3);
+    CHECK(result[0] == "http://opcfoundation.org/UA/");
+    CHECK(result[2] == "Server");
+}
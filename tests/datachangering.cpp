@@ -0,0 +1,141 @@
+#include <array>
+#include <cmath>  // isnan
+#include <cstdint>
+#include <thread>
+#include <utility>  // pair
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "open62541pp/config.hpp"
+#include "open62541pp/datachangering.hpp"
+#include "open62541pp/services/attribute_highlevel.hpp"  // writeValue
+#include "open62541pp/services/nodemanagement.hpp"  // addVariable
+#include "open62541pp/subscription.hpp"
+
+#include "helper/server_client_setup.hpp"
+
+using namespace opcua;
+
+TEST_CASE("DataChangeRing") {
+    SECTION("Capacity") {
+        CHECK(DataChangeRing<int>{0}.capacity() == 2);
+        CHECK(DataChangeRing<int>{8}.capacity() == 8);
+        CHECK(DataChangeRing<int>{1000}.capacity() == 1024);
+    }
+
+    SECTION("Push and pop") {
+        DataChangeRing<int> ring{4};
+        std::array<int, 8> items{};
+        CHECK(ring.pop(items) == 0);
+        CHECK(ring.push(1));
+        CHECK(ring.push(2));
+        CHECK(ring.size() == 2);
+        CHECK(ring.pop(Span{items.data(), 1}) == 1);
+        CHECK(items[0] == 1);
+        CHECK(ring.pop(items) == 1);
+        CHECK(items[0] == 2);
+        CHECK(ring.size() == 0);
+    }
+
+    SECTION("Drop newest") {
+        DataChangeRing<int> ring{4, RingOverflow::DropNewest};
+        for (int i = 0; i < 10; ++i) {
+            CHECK(ring.push(int{i}) == (i < 4));
+        }
+        CHECK(ring.dropped() == 6);
+        std::array<int, 8> items{};
+        CHECK(ring.pop(items) == 4);
+        CHECK(items[3] == 3);
+    }
+
+    SECTION("Single producer, single consumer") {
+        constexpr uint64_t count = 100000;
+        DataChangeRing<uint64_t> ring{64, RingOverflow::Block};
+        bool ordered = true;
+        std::thread consumer([&] {
+            std::vector<uint64_t> items(16);
+            uint64_t expected = 0;
+            while (expected < count) {
+                const size_t popped = ring.pop(items);
+                for (size_t i = 0; i < popped; ++i) {
+                    ordered = ordered && items[i] == expected;
+                    ++expected;
+                }
+            }
+        });
+        for (uint64_t i = 0; i < count; ++i) {
+            ring.push(uint64_t{i});
+        }
+        consumer.join();
+        CHECK(ordered);
+        CHECK(ring.size() == 0);
+        CHECK(ring.dropped() == 0);
+    }
+}
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+TEST_CASE("DataChangeRing sink") {
+    ServerClientSetup setup;
+    setup.client.connect(setup.endpointUrl);
+    auto& server = setup.server;
+    auto& client = setup.client;
+
+    const NodeId doubleId{1, 1000};
+    const NodeId stringId{1, 1001};
+    for (const auto& id : {doubleId, stringId}) {
+        REQUIRE(services::addVariable(
+            server,
+            NodeId{ObjectId::ObjectsFolder},
+            id,
+            "Variable",
+            {},
+            VariableTypeId::BaseDataVariableType,
+            ReferenceTypeId::HasComponent
+        ));
+    }
+    services::writeValue(server, doubleId, Variant{11.11}).throwIfBad();
+    services::writeValue(server, stringId, Variant{String{"text"}}).throwIfBad();
+
+    Subscription sub{client};
+
+    SECTION("DataValue") {
+        DataChangeRing<std::pair<IntegerId, DataValue>> ring{16};
+        sub.setDataChangeBatchCallback(makeDataChangeSink(ring));
+        const auto mon = sub.subscribeDataChange(doubleId, AttributeId::Value, {});
+
+        std::array<std::pair<IntegerId, DataValue>, 4> changes{};
+        size_t popped = 0;
+        CHECK(runIterateUntil(client, [&] {
+            popped += ring.pop(Span{changes.data() + popped, changes.size() - popped});
+            return popped > 0;
+        }));
+        CHECK(changes[0].first == mon.monitoredItemId());
+        CHECK(changes[0].second.value().scalar<double>() == 11.11);
+    }
+
+    SECTION("NumericDataChange") {
+        DataChangeRing<NumericDataChange> ring{16};
+        sub.setDataChangeBatchCallback(makeDataChangeSink(ring));
+        const auto monDouble = sub.subscribeDataChange(doubleId, AttributeId::Value, {});
+        const auto monString = sub.subscribeDataChange(stringId, AttributeId::Value, {});
+
+        std::array<NumericDataChange, 4> changes{};
+        size_t popped = 0;
+        CHECK(runIterateUntil(client, [&] {
+            popped += ring.pop(Span{changes.data() + popped, changes.size() - popped});
+            return popped >= 2;
+        }));
+        for (size_t i = 0; i < popped; ++i) {
+            if (changes[i].monitoredItemId == monDouble.monitoredItemId()) {
+                CHECK(changes[i].value == 11.11);
+                CHECK(changes[i].status.isGood());
+            } else {
+                CHECK(changes[i].monitoredItemId == monString.monitoredItemId());
+                CHECK(std::isnan(changes[i].value));
+                CHECK(changes[i].status == UA_STATUSCODE_BADTYPEMISMATCH);
+            }
+        }
+    }
+}
+#endif
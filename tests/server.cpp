@@ -1,4 +1,5 @@
 #include <array>
+#include <atomic>
 #include <chrono>
 #include <thread>
 
@@ -339,6 +340,96 @@ TEST_CASE("DataSource") {
     }
 }
 
+struct DataSourceWorkerTest : public DataSourceBase {
+    StatusCode read(
+        [[maybe_unused]] Session& session,
+        [[maybe_unused]] const NodeId& id,
+        [[maybe_unused]] const NumericRange* range,
+        DataValue& dv,
+        [[maybe_unused]] bool timestamp
+    ) override {
+        ++reads;
+        dv.setValue(Variant{data.load()});
+        return UA_STATUSCODE_GOOD;
+    }
+
+    StatusCode write(
+        [[maybe_unused]] Session& session,
+        [[maybe_unused]] const NodeId& id,
+        [[maybe_unused]] const NumericRange* range,
+        const DataValue& dv
+    ) override {
+        data = dv.value().scalar<int>();
+        return UA_STATUSCODE_GOOD;
+    }
+
+    std::atomic<int> data = 0;
+    std::atomic<int> reads = 0;
+};
+
+TEST_CASE("DataSource with workers") {
+    Server server;
+
+    const NodeId id{1, 1000};
+    auto node = Node{server, ObjectId::ObjectsFolder}.addVariable(id, "TestVariable");
+    DataSourceWorkerTest source;
+    source.data = 1;
+    setVariableNodeValueBackend(server, id, source);
+    setDataSourceCaching(server, id);
+    enableDataSourceWorkers(server, {2, 100, std::chrono::hours{1}});
+
+    SECTION("read initial value synchronously") {
+        CHECK(node.readValue().to<int>() == 1);
+        CHECK(source.reads == 1);
+    }
+
+    SECTION("read cached value") {
+        CHECK(node.readValue().to<int>() == 1);
+        const int reads = source.reads;
+        source.data = 2;
+        CHECK(node.readValue().to<int>() == 1);  // not expired yet
+        CHECK(source.reads == reads);
+    }
+
+    SECTION("refresh expired value") {
+        enableDataSourceWorkers(server, {2, 100, std::chrono::milliseconds{0}});
+        CHECK(node.readValue().to<int>() == 1);
+        source.data = 2;
+        // the stale value is returned until the refresh of a worker thread completed
+        while (node.readValue().to<int>() != 2) {
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        }
+    }
+
+    SECTION("write invalidates cached value") {
+        CHECK(node.readValue().to<int>() == 1);
+        node.writeValue(Variant{3});
+        CHECK(source.data == 3);
+        CHECK(node.readValue().to<int>() == 3);
+    }
+
+    SECTION("disable caching") {
+        setDataSourceCaching(server, id, false);
+        CHECK(node.readValue().to<int>() == 1);
+        source.data = 2;
+        CHECK(node.readValue().to<int>() == 2);
+    }
+
+    SECTION("delete node with queued refresh") {
+        enableDataSourceWorkers(server, {1, 100, std::chrono::milliseconds{0}});
+        CHECK(node.readValue().to<int>() == 1);
+        CHECK(node.readValue().to<int>() == 1);  // queues a refresh
+        node.deleteNode();
+        disableDataSourceWorkers(server);  // complete queued refreshes
+        CHECK(source.reads <= 2);  // refreshes after the deletion are skipped
+    }
+
+    SECTION("disable workers") {
+        disableDataSourceWorkers(server);
+        CHECK(node.readValue().to<int>() == 1);
+    }
+}
+
 TEST_CASE("Server teardown with custom struct type and a stored variable node") {
     struct Point {
         std::int32_t x;
@@ -1,9 +1,13 @@
+#include <chrono>
+#include <future>
+#include <string>
 #include <vector>
 
 #include <catch2/catch_template_test_macros.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include "open62541pp/config.hpp"
+#include "open62541pp/detail/client_context.hpp"
 #include "open62541pp/services/attribute.hpp"
 #include "open62541pp/services/attribute_highlevel.hpp"
 #include "open62541pp/services/nodemanagement.hpp"  // add*
@@ -239,6 +243,27 @@ TEST_CASE("Attribute service set (highlevel)") {
         CHECK(variantRead.scalar<double>() == 11.11);
     }
 
+    SECTION("Read/write value with NodeIdView") {
+        const NodeIdView id{1, "TestValueView"};
+        REQUIRE(services::addVariable(
+            server,
+            objectsId,
+            id,
+            "TestValueView",
+            {},
+            VariableTypeId::BaseDataVariableType,
+            ReferenceTypeId::HasComponent
+        ));
+
+        services::writeAttribute(server, id, AttributeId::Value, DataValue{Variant{11.11}})
+            .throwIfBad();
+
+        const auto dv = services::readAttribute(
+            server, id, AttributeId::Value, TimestampsToReturn::Neither
+        );
+        CHECK(dv.value().value().scalar<double>() == 11.11);
+    }
+
     SECTION("Read/write data value") {
         const NodeId id{1, "TestDataValue"};
         REQUIRE(services::addVariable(
@@ -339,6 +364,197 @@ TEST_CASE("Attribute service set (highlevel, async)") {
     // sync and async functions use the same attribute handlers, so testing one attribute is enough
 }
 
+TEST_CASE("Attribute service set batched read") {
+    ServerClientSetup setup;
+    auto& server = setup.server;
+    auto& client = setup.client;
+
+    std::vector<NodeId> ids;
+    for (uint32_t i = 0; i < 5; ++i) {
+        const NodeId id{1, 1000 + i};
+        REQUIRE(services::addVariable(
+            server,
+            {0, UA_NS0ID_OBJECTSFOLDER},
+            id,
+            "Variable",
+            VariableAttributes{}.setValue(Variant{static_cast<double>(i)}),
+            VariableTypeId::BaseDataVariableType,
+            ReferenceTypeId::HasComponent
+        ));
+        ids.push_back(id);
+    }
+    ids.emplace_back(1, 9999);  // unknown node
+
+    // 0: no limit, 2: three chunks sent in parallel
+    for (const uint32_t maxNodesPerRead : {0U, 2U}) {
+        CAPTURE(maxNodesPerRead);
+        services::writeValue(
+            server,
+            VariableId::Server_ServerCapabilities_OperationLimits_MaxNodesPerRead,
+            Variant{maxNodesPerRead}
+        )
+            .throwIfBad();
+        client.connect(setup.endpointUrl);  // operation limits are cached per session
+
+        // readValues
+        {
+            const auto results = services::readValues(client, ids);
+            REQUIRE(results.size() == 6);
+            for (size_t i = 0; i < 5; ++i) {
+                CHECK(results[i].value().scalar<double>() == static_cast<double>(i));
+            }
+            CHECK(results[5].code() == UA_STATUSCODE_BADNODEIDUNKNOWN);
+        }
+
+        // readValuesAs with reused output vector
+        {
+            std::vector<Result<double>> results{Result<double>{1.0}};
+            services::readValuesAs(client, ids, results);
+            REQUIRE(results.size() == 6);
+            for (size_t i = 0; i < 5; ++i) {
+                CHECK(results[i].value() == static_cast<double>(i));
+            }
+            CHECK(results[5].code() == UA_STATUSCODE_BADNODEIDUNKNOWN);
+        }
+
+        // readValuesAs with type mismatch
+        {
+            const auto results = services::readValuesAs<std::string>(client, ids);
+            REQUIRE(results.size() == 6);
+            CHECK(results[0].code().isBad());
+        }
+
+        client.disconnect();
+    }
+}
+
+TEST_CASE("Attribute service set batched write") {
+    ServerClientSetup setup;
+    auto& server = setup.server;
+    auto& client = setup.client;
+
+    std::vector<NodeId> ids;
+    std::vector<Variant> values;
+    for (uint32_t i = 0; i < 5; ++i) {
+        const NodeId id{1, 1000 + i};
+        REQUIRE(services::addVariable(
+            server,
+            {0, UA_NS0ID_OBJECTSFOLDER},
+            id,
+            "Variable",
+            VariableAttributes{}.setAccessLevel(
+                AccessLevel::CurrentRead | AccessLevel::CurrentWrite
+            ),
+            VariableTypeId::BaseDataVariableType,
+            ReferenceTypeId::HasComponent
+        ));
+        ids.push_back(id);
+        values.emplace_back(static_cast<double>(i));
+    }
+    ids.emplace_back(1, 9999);  // unknown node
+    values.emplace_back(0.0);
+
+    auto checkResults = [&](const std::vector<StatusCode>& results) {
+        REQUIRE(results.size() == 6);
+        for (size_t i = 0; i < 5; ++i) {
+            CHECK(results[i].isGood());
+            const auto value = services::readValue(server, ids[i]).value();
+            CHECK(value.scalar<double>() == values[i].scalar<double>());
+        }
+        CHECK(results[5] == UA_STATUSCODE_BADNODEIDUNKNOWN);
+    };
+
+    // 0: no limit, 2: three chunks sent in parallel
+    for (const uint32_t maxNodesPerWrite : {0U, 2U}) {
+        CAPTURE(maxNodesPerWrite);
+        services::writeValue(
+            server,
+            VariableId::Server_ServerCapabilities_OperationLimits_MaxNodesPerWrite,
+            Variant{maxNodesPerWrite}
+        )
+            .throwIfBad();
+        client.connect(setup.endpointUrl);  // operation limits are cached per session
+
+        // writeValues
+        checkResults(services::writeValues(client, ids, values));
+
+        // writeValuesAsync
+        {
+            for (auto& value : values) {
+                value = Variant{value.scalar<double>() + 10.0};
+            }
+            auto future = services::writeValuesAsync(client, ids, values, useFuture);
+            while (future.wait_for(std::chrono::seconds{0}) != std::future_status::ready) {
+                client.runIterate();
+            }
+            checkResults(future.get());
+        }
+
+        // size mismatch
+        CHECK_THROWS_AS(
+            services::writeValues(client, ids, Span<const Variant>{values.data(), 1}), BadStatus
+        );
+
+        client.disconnect();
+    }
+
+    // results of multiple chunks are merged in order of the nodes
+    {
+        client.connect(setup.endpointUrl);
+        const std::vector<NodeId> mixedIds{ids[0], NodeId{1, 9999}, ids[1], ids[2], ids[3]};
+        const std::vector<Variant> mixedValues{
+            Variant{20.0}, Variant{21.0}, Variant{22.0}, Variant{23.0}, Variant{24.0}
+        };
+        auto checkMixedResults = [&](const std::vector<StatusCode>& results) {
+            REQUIRE(results.size() == 5);
+            CHECK(results[0].isGood());
+            CHECK(results[1] == UA_STATUSCODE_BADNODEIDUNKNOWN);
+            CHECK(results[2].isGood());
+            CHECK(results[3].isGood());
+            CHECK(results[4].isGood());
+            CHECK(services::readValue(server, ids[0]).value().scalar<double>() == 20.0);
+            CHECK(services::readValue(server, ids[3]).value().scalar<double>() == 24.0);
+        };
+
+        // operation limit not cached yet, read by writeValuesAsync (server limit of 2 nodes)
+        REQUIRE_FALSE(detail::getContext(client).operationLimits.maxNodesPerWrite.has_value());
+        {
+            auto future = services::writeValuesAsync(client, mixedIds, mixedValues, useFuture);
+            while (future.wait_for(std::chrono::seconds{0}) != std::future_status::ready) {
+                client.runIterate();
+            }
+            checkMixedResults(future.get());
+        }
+
+        // forced limit of a single node per chunk
+        detail::getContext(client).operationLimits.maxNodesPerWrite = 1;
+        checkMixedResults(services::writeValues(client, mixedIds, mixedValues));
+        {
+            auto future = services::writeValuesAsync(client, mixedIds, mixedValues, useFuture);
+            while (future.wait_for(std::chrono::seconds{0}) != std::future_status::ready) {
+                client.runIterate();
+            }
+            checkMixedResults(future.get());
+        }
+
+        client.disconnect();
+
+        // the requests can not be sent, the handler is invoked with bad results
+        auto checkNotSent = [&] {
+            auto future = services::writeValuesAsync(client, mixedIds, mixedValues, useFuture);
+            REQUIRE(future.wait_for(std::chrono::seconds{0}) == std::future_status::ready);
+            const auto results = future.get();
+            REQUIRE(results.size() == 5);
+            for (const auto& result : results) {
+                CHECK(result.isBad());
+            }
+        };
+        checkNotSent();  // chunks not sent
+        detail::getContext(client).operationLimits.maxNodesPerWrite.reset();
+        checkNotSent();  // operation limit not read
+    }
+}
+
 TEMPLATE_TEST_CASE("Attribute service set write/read", "", Server, Client, Async<Client>) {
     ServerClientSetup setup;
     setup.client.connect(setup.endpointUrl);
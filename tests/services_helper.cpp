@@ -1,9 +1,11 @@
 #include <string>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
 
 #include "open62541pp/services/detail/async_hook.hpp"
 #include "open62541pp/services/detail/async_transform.hpp"
+#include "open62541pp/services/detail/request_handling.hpp"
 #include "open62541pp/services/detail/response_handling.hpp"
 #include "open62541pp/ua/types.hpp"
 
@@ -85,3 +87,20 @@ TEST_CASE("Response handling") {
         );
     }
 }
+
+TEST_CASE("Request handling") {
+    SECTION("makeBrowsePath") {
+        const std::vector<QualifiedName> names{{0, "Types"}, {0, "ObjectTypes"}};
+        const auto elements = services::detail::makeRelativePathElements(names);
+        REQUIRE(elements.size() == 2);
+        CHECK(elements[0].referenceTypeId == NodeId(ReferenceTypeId::HierarchicalReferences));
+        CHECK(elements[0].isInverse == false);
+        CHECK(elements[0].includeSubtypes == true);
+        CHECK(elements[1].targetName.name.data == names[1].handle()->name.data);  // no copy
+
+        const auto browsePath = services::detail::makeBrowsePath({0, 84}, elements);
+        CHECK(browsePath.startingNode == NodeId(0, 84));
+        CHECK(browsePath.relativePath.elementsSize == 2);
+        CHECK(browsePath.relativePath.elements == elements.data());
+    }
+}
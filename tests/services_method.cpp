@@ -1,4 +1,6 @@
+#include <chrono>
 #include <functional>  // hash
+#include <future>
 #include <thread>
 
 #include <catch2/catch_template_test_macros.hpp>
@@ -265,6 +267,37 @@ TEST_CASE("Method calls with async operations") {
         CHECK(result.statusCode().isGood());
         CHECK(result.outputArguments().at(0).to<uint64_t>() == getThreadId());
     }
+
+    SECTION("Async operation workers") {
+        useAsyncOperation(setup.server, methodId, true);
+        enableAsyncOperationWorkers(setup.server, 2);
+        auto future = services::callAsync(setup.client, objectId, methodId, {}, useFuture);
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{1};
+        while (future.wait_for(std::chrono::milliseconds{10}) != std::future_status::ready &&
+               std::chrono::steady_clock::now() < deadline) {
+            setup.client.runIterate();
+        }
+        const auto result = future.get();
+        CHECK(result.statusCode().isGood());
+        CHECK(result.outputArguments().at(0).to<uint64_t>() != getThreadId());
+
+        // statistics are updated after the result is sent
+        auto statistics = getAsyncOperationStatistics(setup.server);
+        while ((statistics.queued > 0 || statistics.running > 0 || statistics.methods.empty()) &&
+               std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+            statistics = getAsyncOperationStatistics(setup.server);
+        }
+        CHECK(statistics.queued == 0);
+        CHECK(statistics.running == 0);
+        REQUIRE(statistics.methods.size() == 1);
+        CHECK(statistics.methods[0].methodId == methodId);
+        CHECK(statistics.methods[0].count == 1);
+        CHECK(statistics.methods[0].maxDuration <= statistics.methods[0].totalDuration);
+
+        disableAsyncOperationWorkers(setup.server);
+        CHECK(getAsyncOperationStatistics(setup.server).methods.empty());
+    }
 #endif
 }
 #endif
@@ -1,10 +1,12 @@
 #include <chrono>
 #include <thread>
+#include <vector>
 
 #include <catch2/catch_template_test_macros.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include "open62541pp/config.hpp"
+#include "open62541pp/detail/client_context.hpp"
 #include "open62541pp/event.hpp"
 #include "open62541pp/services/attribute_highlevel.hpp"  // writeValue
 #include "open62541pp/services/monitoreditem.hpp"
@@ -307,6 +309,69 @@ TEMPLATE_TEST_CASE("MonitoredItem service set", "", Client, Async<Client>) {
     }
 }
 
+TEST_CASE("MonitoredItem service set (multiple items)") {
+    ServerClientSetup setup;
+    setup.client.connect(setup.endpointUrl);
+    auto& client = setup.client;
+
+    const auto subId =
+        services::createSubscription(client, {}, true, {}, {}).subscriptionId();
+    const std::vector<ReadValueId> items{
+        {VariableId::Server_ServerStatus_CurrentTime, AttributeId::Value},
+        {VariableId::Server_ServerStatus_StartTime, AttributeId::Value},
+        {NodeId{1, 9999}, AttributeId::Value},  // unknown node
+        {VariableId::Server_ServerStatus_State, AttributeId::Value},
+        {VariableId::Server_ServiceLevel, AttributeId::Value},
+    };
+    size_t notificationCount = 0;
+    const auto callback = [&](IntegerId, IntegerId, const DataValue&) { notificationCount++; };
+
+    const auto check = [&](const std::vector<MonitoredItemCreateResult>& results) {
+        REQUIRE(results.size() == items.size());
+        for (size_t i = 0; i < results.size(); ++i) {
+            CAPTURE(i);
+            CHECK(results[i].statusCode().isGood() == (i != 2));
+        }
+        CHECK(results[0].monitoredItemId() != results[1].monitoredItemId());
+        const auto& monitoredItems = detail::getContext(client).monitoredItems;
+        CHECK(monitoredItems.size() == items.size() - 1);
+
+        // contexts of the same request share the callbacks
+        const auto* first = monitoredItems.find({subId, results[0].monitoredItemId()});
+        const auto* second = monitoredItems.find({subId, results[1].monitoredItemId()});
+        REQUIRE(first != nullptr);
+        REQUIRE(second != nullptr);
+        CHECK(first->callbacks == second->callbacks);
+        CHECK(first->nodeId == items[0].nodeId());
+        CHECK(second->nodeId == items[1].nodeId());
+        CHECK(runIterateUntil(client, [&] { return notificationCount >= items.size() - 1; }));
+    };
+
+    SECTION("Single request") {
+        check(services::createMonitoredItemsDataChange(
+            client, subId, items, MonitoringMode::Reporting, {}, callback, {}
+        ));
+    }
+
+    SECTION("Split by MaxMonitoredItemsPerCall") {
+        detail::getContext(client).operationLimits.maxMonitoredItemsPerCall = 2;
+        check(services::createMonitoredItemsDataChange(
+            client, subId, items, MonitoringMode::Reporting, {}, callback, {}
+        ));
+    }
+
+    SECTION("Invalid subscription") {
+        const auto results = services::createMonitoredItemsDataChange(
+            client, subId + 1, items, MonitoringMode::Reporting, {}, callback, {}
+        );
+        REQUIRE(results.size() == items.size());
+        for (const auto& result : results) {
+            CHECK(result.statusCode() == UA_STATUSCODE_BADSUBSCRIPTIONIDINVALID);
+        }
+        CHECK(detail::getContext(client).monitoredItems.size() == 0);
+    }
+}
+
 TEST_CASE("MonitoredItem service set (server)") {
     Server server;
     const NodeId id{1, 1000};
@@ -1,3 +1,8 @@
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <vector>
+
 #include <catch2/catch_template_test_macros.hpp>
 #include <catch2/catch_test_macros.hpp>
 
@@ -149,3 +154,109 @@ TEMPLATE_TEST_CASE("View service set", "", Server, Client, Async<Client>) {
         }
     }
 }
+
+TEST_CASE("View service set (pipelined browseAll)") {
+    ServerClientSetup setup;
+    setup.client.connect(setup.endpointUrl);
+    auto& client = setup.client;
+
+    const std::vector<BrowseDescription> bds{
+        {NodeId{ObjectId::ObjectsFolder}, BrowseDirection::Both},
+        {NodeId{ObjectId::Server}, BrowseDirection::Both},
+        {NodeId{ObjectId::TypesFolder}, BrowseDirection::Both},
+        {NodeId{1, 9999}, BrowseDirection::Both},  // unknown node
+    };
+    std::vector<size_t> expected;
+    for (const auto& bd : bds) {
+        const auto refs = services::browseAll(client, bd);
+        expected.push_back(refs.hasValue() ? refs->size() : 0);
+    }
+
+    services::BrowseAllOptions options;
+    options.maxReferencesPerNode = 1;  // force continuation points
+    options.maxNodesPerRequest = 2;
+    options.maxRequestsInFlight = 2;
+
+    std::vector<size_t> counts(bds.size(), 0);
+    const auto callback = [&](size_t index, Span<ReferenceDescription> refs) {
+        REQUIRE(index < counts.size());
+        counts[index] += refs.size();
+    };
+
+    SECTION("Sync") {
+        const auto results = services::browseAll(client, bds, callback, options);
+        REQUIRE(results.size() == bds.size());
+        CHECK(results[0].isGood());
+        CHECK(results[1].isGood());
+        CHECK(results[2].isGood());
+        CHECK(results[3] == UA_STATUSCODE_BADNODEIDUNKNOWN);
+        CHECK(counts == expected);
+    }
+
+    SECTION("Async") {
+        auto future = services::browseAllAsync(client, bds, callback, options, useFuture);
+        while (future.wait_for(std::chrono::seconds{0}) != std::future_status::ready) {
+            client.runIterate();
+        }
+        CHECK(future.get().size() == bds.size());
+        CHECK(counts == expected);
+    }
+
+    SECTION("Async single node") {
+        auto future = services::browseAllAsync(client, bds[0], useFuture);
+        while (future.wait_for(std::chrono::seconds{0}) != std::future_status::ready) {
+            client.runIterate();
+        }
+        CHECK(future.get().value().size() == expected[0]);
+    }
+
+    SECTION("Deferred with temporary browse descriptions") {
+        auto deferred = [&] {
+            const std::vector<BrowseDescription> tmp(bds);  // destroyed before initiation
+            return services::browseAllAsync(client, tmp, callback, options, useDeferred);
+        }();
+        auto future = deferred(useFuture);
+        while (future.wait_for(std::chrono::seconds{0}) != std::future_status::ready) {
+            client.runIterate();
+        }
+        CHECK(future.get().size() == bds.size());
+        CHECK(counts == expected);
+    }
+
+    SECTION("Async with throwing callback") {
+        auto future = services::browseAllAsync(
+            client,
+            bds,
+            [](size_t, Span<ReferenceDescription>) { throw std::runtime_error("abort"); },
+            options,
+            useFuture
+        );
+        bool thrown = false;
+        while (future.wait_for(std::chrono::seconds{0}) != std::future_status::ready) {
+            try {
+                client.runIterate();
+            } catch (const std::runtime_error&) {
+                thrown = true;
+            }
+        }
+        CHECK(thrown);
+        const auto results = future.get();
+        REQUIRE(results.size() == bds.size());
+        CHECK(results[0] == UA_STATUSCODE_BADREQUESTCANCELLEDBYCLIENT);
+    }
+
+    SECTION("Async on disconnected client") {
+        client.disconnect();
+        auto future = services::browseAllAsync(client, bds, callback, options, useFuture);
+        REQUIRE(future.wait_for(std::chrono::seconds{0}) == std::future_status::ready);
+        const auto results = future.get();
+        REQUIRE(results.size() == bds.size());
+        for (const auto& result : results) {
+            CHECK(result.isBad());
+        }
+    }
+
+    SECTION("Empty") {
+        CHECK(services::browseAll(client, {}, callback).empty());
+    }
+}
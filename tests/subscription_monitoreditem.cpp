@@ -1,10 +1,20 @@
+#include <algorithm>  // find_if
+#include <chrono>
+#include <iterator>  // make_move_iterator
+#include <thread>
+#include <utility>  // pair
+#include <vector>
+
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_all.hpp>
 
 #include "open62541pp/client.hpp"
 #include "open62541pp/config.hpp"
+#include "open62541pp/detail/client_context.hpp"
 #include "open62541pp/monitoreditem.hpp"
 #include "open62541pp/server.hpp"
+#include "open62541pp/services/attribute_highlevel.hpp"
+#include "open62541pp/services/nodemanagement.hpp"
 #include "open62541pp/subscription.hpp"
 #include "open62541pp/ua/types.hpp"
 
@@ -51,6 +61,21 @@ TEST_CASE("Subscription & MonitoredItem (server)") {
         mon.deleteMonitoredItem();
         CHECK(sub.monitoredItems().empty());
     }
+
+    SECTION("Monitor data changes of multiple nodes") {
+        Subscription sub{server};
+        const std::vector<NodeId> ids{
+            VariableId::Server_ServerStatus_CurrentTime,
+            VariableId::Server_ServerStatus_StartTime,
+        };
+        auto monItems = sub.subscribeDataChanges(ids, AttributeId::Value, {});
+        REQUIRE(monItems.size() == 2);
+        CHECK(monItems[0].hasValue());
+        CHECK(monItems[1].hasValue());
+        const auto monitoredItems = sub.monitoredItems();
+        REQUIRE(monitoredItems.size() == 2);
+        CHECK(monitoredItems[0].monitoredItemId() < monitoredItems[1].monitoredItemId());
+    }
 }
 
 TEST_CASE("Subscription & MonitoredItem (client)") {
@@ -154,6 +179,159 @@ TEST_CASE("Subscription & MonitoredItem (client)") {
         CHECK(monItem2.monitoredItemId() == monId2);
     }
 
+    SECTION("Monitor typed data changes") {
+        Subscription sub{client};
+
+        DateTime currentTime;
+        DateTime sourceTimestamp;
+        sub.subscribeDataChange<DateTime>(
+            VariableId::Server_ServerStatus_CurrentTime,
+            AttributeId::Value,
+            [&](IntegerId, const DateTime& value, DateTime timestamp) {
+                currentTime = value;
+                sourceTimestamp = timestamp;
+            },
+            [&](IntegerId, StatusCode) { FAIL("Unexpected error"); }
+        );
+
+        size_t valueCount = 0;
+        StatusCode error;
+        sub.subscribeDataChange<double>(
+            VariableId::Server_ServerStatus_CurrentTime,
+            AttributeId::Value,
+            [&](IntegerId, const double&, DateTime) { valueCount++; },
+            [&](IntegerId, StatusCode code) { error = code; }
+        );
+
+        CHECK(runIterateUntil(client, [&] { return currentTime.get() != 0 && error.isBad(); }));
+        CHECK(sourceTimestamp.get() != 0);
+        CHECK(valueCount == 0);
+        CHECK(error == UA_STATUSCODE_BADTYPEMISMATCH);
+    }
+
+    SECTION("Monitor data changes of multiple nodes") {
+        Subscription sub{client};
+        const std::vector<NodeId> ids{
+            VariableId::Server_ServerStatus_CurrentTime,
+            NodeId{1, 9999},  // unknown node
+            VariableId::Server_ServerStatus_StartTime,
+        };
+        size_t notificationCount = 0;
+        auto monItems = sub.subscribeDataChanges(
+            ids, AttributeId::Value, [&](IntegerId, IntegerId, const DataValue&) {
+                notificationCount++;
+            }
+        );
+        REQUIRE(monItems.size() == 3);
+        CHECK(monItems[0].hasValue());
+        CHECK(monItems[1].code() == UA_STATUSCODE_BADNODEIDUNKNOWN);
+        CHECK(monItems[2].hasValue());
+        CHECK(sub.monitoredItems().size() == 2);
+        CHECK(runIterateUntil(client, [&] { return notificationCount >= 2; }));
+    }
+
+    SECTION("Batched data changes") {
+        const std::vector<NodeId> ids{{1, 1000}, {1, 1001}, {1, 1002}};
+        for (const auto& id : ids) {
+            REQUIRE(services::addVariable(
+                setup.server,
+                {0, UA_NS0ID_OBJECTSFOLDER},
+                id,
+                "Variable",
+                {},
+                VariableTypeId::BaseDataVariableType,
+                ReferenceTypeId::HasComponent
+            ));
+            services::writeValue(setup.server, id, Variant{int32_t{0}}).throwIfBad();
+        }
+        const auto writeValues = [&](int32_t value) {
+            for (const auto& id : ids) {
+                services::writeValue(client, id, Variant{value}).throwIfBad();
+            }
+        };
+
+        SubscriptionParameters subscriptionParameters{};
+        subscriptionParameters.publishingInterval = 50.0;
+        Subscription sub{client, subscriptionParameters};
+        const auto subId = sub.subscriptionId();
+        std::vector<std::vector<std::pair<IntegerId, DataValue>>> batches;
+        sub.setDataChangeBatchCallback(
+            [&](IntegerId id, Span<std::pair<IntegerId, DataValue>> changes) {
+                CHECK(id == subId);
+                CHECK_FALSE(changes.empty());
+                batches.emplace_back(
+                    std::make_move_iterator(changes.begin()), std::make_move_iterator(changes.end())
+                );
+            }
+        );
+
+        MonitoringParametersEx monitoringParameters{};
+        monitoringParameters.samplingInterval = 0.0;  // = fastest practical
+        size_t notificationCount = 0;
+        const auto monItems = sub.subscribeDataChanges(
+            ids,
+            AttributeId::Value,
+            MonitoringMode::Reporting,
+            monitoringParameters,
+            [&](IntegerId, IntegerId, const DataValue&) { notificationCount++; }
+        );
+        REQUIRE(monItems.size() == ids.size());
+        const auto countChanges = [&] {
+            size_t count = 0;
+            for (const auto& batch : batches) {
+                count += batch.size();
+            }
+            return count;
+        };
+        CHECK(runIterateUntil(client, [&] { return countChanges() >= ids.size(); }));
+        CHECK(notificationCount == 0);  // replaced by batch callback
+
+        // hold back the notifications of the written values, they are published at once
+        sub.setPublishingMode(false);
+        batches.clear();
+        writeValues(1);
+        std::this_thread::sleep_for(std::chrono::milliseconds{100});  // sample written values
+        sub.setPublishingMode(true);
+        CHECK(runIterateUntil(client, [&] { return !batches.empty(); }));
+        REQUIRE(batches.size() == 1);
+        REQUIRE(batches[0].size() == ids.size());
+        for (const auto& monItem : monItems) {
+            const auto it = std::find_if(batches[0].begin(), batches[0].end(), [&](auto& change) {
+                return change.first == monItem->monitoredItemId();
+            });
+            REQUIRE(it != batches[0].end());
+            CHECK(it->second.value().scalar<int32_t>() == 1);
+        }
+
+        // data changes received within synchronous service calls are buffered until runIterate
+        sub.setPublishingMode(false);
+        batches.clear();
+        writeValues(2);
+        std::this_thread::sleep_for(std::chrono::milliseconds{100});
+        sub.setPublishingMode(true);
+        const auto& pending = opcua::detail::getContext(client).pendingDataChangeBatches;
+        for (int i = 0; i < 1000 && pending.empty(); ++i) {
+            CHECK(services::readValue(client, ids[0]).hasValue());
+        }
+        REQUIRE_FALSE(pending.empty());
+        CHECK(batches.empty());
+
+        // buffered data changes are delivered before the batch callback is cleared
+        sub.setDataChangeBatchCallback({});
+        CHECK(pending.empty());
+        REQUIRE(batches.size() == 1);
+        CHECK(batches[0].size() == ids.size());
+
+        // restore callbacks of the monitored items
+        writeValues(3);
+        CHECK(runIterateUntil(client, [&] { return notificationCount >= ids.size(); }));
+        CHECK(batches.size() == 1);
+
+        CHECK_THROWS_WITH(
+            services::setDataChangeBatchCallback(client, subId + 1, {}), "BadSubscriptionIdInvalid"
+        );
+    }
+
     SECTION("Modify monitored item") {
         Subscription sub{client};
         auto mon = sub.subscribeDataChange(
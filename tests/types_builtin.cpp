@@ -208,6 +208,19 @@ TEMPLATE_TEST_CASE("StringLike ostream overloads", "", String) {
     CHECK(ss.str() == "test123");
 }
 
+TEST_CASE("StringView") {
+    const std::string str{"test123"};
+    const StringView view{str};
+    CHECK(view.size() == 7);
+    CHECK_FALSE(view.empty());
+    CHECK(view.data() == str.data());  // no copy
+    CHECK(static_cast<std::string_view>(view) == "test123");
+
+    const String& wrapper = view;
+    CHECK(wrapper.handle() == view.handle());
+    CHECK(wrapper == String{"test123"});
+}
+
 TEST_CASE("ByteString") {
     SECTION("Construct from string") {
         const ByteString bs{"XYZ"};
@@ -481,6 +494,40 @@ TEST_CASE("NodeId") {
     }
 }
 
+TEST_CASE("NodeIdView") {
+    SECTION("Numeric identifier") {
+        const NodeIdView view{1, 1000};
+        CHECK(view.namespaceIndex() == 1);
+        CHECK(view.identifierType() == NodeIdType::Numeric);
+        CHECK(static_cast<const NodeId&>(view) == NodeId{1, 1000});
+    }
+
+    SECTION("String identifier") {
+        const std::string_view identifier{"Temperature"};
+        const NodeIdView view{1, identifier};
+        CHECK(view.identifierType() == NodeIdType::String);
+        CHECK(view.handle()->identifier.string.data == (const UA_Byte*)identifier.data());  // NOLINT
+        CHECK(static_cast<const NodeId&>(view) == NodeId{1, "Temperature"});
+    }
+
+    SECTION("Enum identifier") {
+        const NodeIdView view{ObjectId::ObjectsFolder};
+        CHECK(static_cast<const NodeId&>(view) == NodeId{ObjectId::ObjectsFolder});
+    }
+
+    SECTION("Pass as NodeId") {
+        const auto getNamespaceIndex = [](const NodeId& id) { return id.namespaceIndex(); };
+        CHECK(getNamespaceIndex(NodeIdView{2, "Temperature"}) == 2);
+    }
+}
+
+TEST_CASE("QualifiedNameView") {
+    const QualifiedNameView view{1, "Temperature"};
+    CHECK(view.namespaceIndex() == 1);
+    CHECK(view.name() == "Temperature");
+    CHECK(static_cast<const QualifiedName&>(view) == QualifiedName{1, "Temperature"});
+}
+
 TEST_CASE("ExpandedNodeId") {
     ExpandedNodeId idLocal{{1, "local"}, {}, 0};
     CHECK(idLocal.isLocal());